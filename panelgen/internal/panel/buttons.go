@@ -26,7 +26,7 @@ func buttons() *Panel {
 	p := NewPanel("BUTTONS", hp, fg, bg, "buttons")
 
 	top := 21.0
-	dy := 12.7
+	dy := 11.0
 	button_x := 5.0
 	negate_x := button_x + 6.5
 	port_x := negate_x + 7.7
@@ -43,5 +43,13 @@ func buttons() *Panel {
 		p.Engrave(negate_x, y, negateLabel)
 	}
 
+	// The ¬ALL port sits left of the negate column, so that its labeled box
+	// clears the ALL port's box.
+	negated_all_shift := 5.0
+	negated_all_x := negate_x - negated_all_shift
+	allY := top + float64(len(labels))*dy
+	p.OutPort(negated_all_x, allY, "¬ALL")
+	p.OutPort(port_x, allY, "ALL")
+
 	return p
 }
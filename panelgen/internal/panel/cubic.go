@@ -8,6 +8,7 @@ import (
 
 func init() {
 	registerBuilder("cubic", cubic)
+	registerBuilder("chebyshev", chebyshev)
 }
 
 func cubic() *Panel {
@@ -55,3 +56,55 @@ func coefficientKnobLabel(exponent int) string {
 	const labelFormat = `X<tspan baseline-shift="super">%d</tspan>`
 	return fmt.Sprintf(labelFormat, exponent)
 }
+
+func chebyshev() *Panel {
+	const (
+		hue = 180
+		hp  = 10
+	)
+	var (
+		bg = svg.HslColor(hue, 1, .97)
+		fg = svg.HslColor(hue, 1, .3)
+	)
+
+	p := NewPanel("CHEBYSHEV", hp, fg, bg, "chebyshev")
+
+	const (
+		top     = 20.0
+		deltaY  = 15.0
+		width   = mmPerHp * hp
+		dx      = width / 4.0
+		column1 = dx / 2.0
+		column2 = column1 + dx
+		column3 = column2 + dx
+		column4 = column3 + dx
+		rows    = 4
+	)
+
+	for row := 0; row < rows; row++ {
+		y := top + deltaY*float64(row)
+		p.CvPort(column1, y)
+		p.SmallKnob(column2, y, harmonicKnobLabel(row+1))
+		p.CvPort(column3, y)
+		p.SmallKnob(column4, y, harmonicKnobLabel(rows+row+1))
+	}
+
+	y := 82.0
+	p.SmallKnob(column2, y, "IN")
+	p.SmallKnob(column3, y, "OUT")
+
+	y = y + deltaY
+	p.CvPort(column2, y) // IN gain
+	p.CvPort(column3, y) // OUT gain
+
+	y = y + deltaY
+	p.InPort(column2, y, "IN")
+	p.OutPort(column3, y, "OUT")
+
+	return p
+}
+
+func harmonicKnobLabel(harmonic int) string {
+	const labelFormat = `T<tspan baseline-shift="sub">%d</tspan>`
+	return fmt.Sprintf(labelFormat, harmonic)
+}
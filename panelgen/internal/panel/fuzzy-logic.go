@@ -7,8 +7,14 @@ import (
 func init() {
 	h := fuzzyLogic("FUZZY LOGIC H")
 	z := fuzzyLogic("FUZZY LOGIC Z")
+	l := fuzzyLogic("FUZZY LOGIC L")
+	hp := fuzzyLogic("FUZZY LOGIC HP")
+	e := fuzzyLogic("FUZZY LOGIC E")
 	registerBuilder("fuzzy-logic-h", h.build)
 	registerBuilder("fuzzy-logic-z", z.build)
+	registerBuilder("fuzzy-logic-l", l.build)
+	registerBuilder("fuzzy-logic-hp", hp.build)
+	registerBuilder("fuzzy-logic-e", e.build)
 }
 
 type fuzzyLogic string
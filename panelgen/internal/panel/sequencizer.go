@@ -53,6 +53,7 @@ func (s sequencizer) build() *Panel {
 		globalControlsTop    = top + portBoxAscent
 		globalControlsBottom = bottom - portBoxDescent
 		globalControlsDy     = (globalControlsBottom - globalControlsTop) / 4.0
+		sequenceControlsDy   = (globalControlsBottom - globalControlsTop) / 5.0
 
 		sequenceBlockLeft  = margin
 		sequenceBlockRight = sequenceBlockLeft + sequenceBlockWidth
@@ -62,16 +63,18 @@ func (s sequencizer) build() *Panel {
 	)
 	y := globalControlsTop
 	p.InButtonPort(sequenceControlsX, y, "RUN")
-	y += globalControlsDy
+	y += sequenceControlsDy
 	p.InButtonPort(sequenceControlsX, y, "LOOP")
-	y += globalControlsDy
+	y += sequenceControlsDy
 	p.HLine(selectionStartX, selectionLengthX, y)
 	p.SmallKnob(selectionStartX, y, "START")
 	p.SmallKnob(selectionLengthX, y, "LEN")
-	y += globalControlsDy
+	y += sequenceControlsDy
 	p.InButtonPort(sequenceControlsX, y, "GATE")
-	y += globalControlsDy
+	y += sequenceControlsDy
 	p.InButtonPort(sequenceControlsX, y, "RESET")
+	y += sequenceControlsDy
+	p.InPort(sequenceControlsX, y, "POS")
 
 	const (
 		globalStepControlsDx = portBoxWidth + padding
@@ -8,6 +8,7 @@ func init() {
 	registerBuilder("booster-stage", boosterStage)
 	registerBuilder("hostage", hostage)
 	registerBuilder("stage", stage)
+	registerBuilder("stage-chain", stageChain)
 	registerBuilder("upstage", upstage)
 }
 
@@ -156,6 +157,61 @@ func stage() *Panel {
 	return p
 }
 
+func stageChain() *Panel {
+	const (
+		hue = 150
+		hp  = 10
+	)
+
+	var (
+		bg = svg.HslColor(hue, 1.0, .97)
+		fg = svg.HslColor(hue, 1.0, .3)
+	)
+
+	p := NewPanel("STAGE CHAIN", hp, fg, bg, "stage-chain")
+
+	const (
+		width      = hp * mmPerHp
+		attack     = width / 8.0
+		decay      = attack + width/4.0
+		hostage    = decay + width/4.0
+		release    = hostage + width/4.0
+		headingY   = 19.0
+		levelY     = 30.0
+		curvatureY = 47.0
+		durationY  = 64.0
+		left       = width/4.0 + 1.0/3.0
+		right      = width - left
+	)
+
+	for _, stage := range []struct {
+		x    float64
+		name string
+	}{{attack, "ATTACK"}, {decay, "DECAY"}, {release, "RELEASE"}} {
+		p.Engrave(stage.x, headingY, svg.TextAbove(stage.name, svg.SmallFont, p.Fg))
+		p.SmallKnob(stage.x, levelY, "LEVEL")
+		p.SmallKnob(stage.x, curvatureY, "CURVE")
+		p.SmallKnob(stage.x, durationY, "DURATION")
+	}
+
+	p.Engrave(hostage, headingY, svg.TextAbove("HOSTAGE", svg.SmallFont, p.Fg))
+	p.ThumbSwitch(hostage, curvatureY, 1, "HOLD", "SUSTAIN")
+	p.SmallKnob(hostage, durationY, "DURATION")
+
+	y := stagePortsTop
+	p.InPort(left, y, "DEFER")
+	p.OutPort(right, y, "ACTIVE")
+
+	y += stagePortsDy
+	p.InPort(left, y, "GATE")
+	p.OutPort(right, y, "EOC")
+
+	y += stagePortsDy
+	p.InPort(left, y, "IN")
+	p.OutPort(right, y, "OUT")
+	return p
+}
+
 func upstage() *Panel {
 	const (
 		hue = 210
@@ -0,0 +1,143 @@
+package panel
+
+import (
+	"fmt"
+
+	"dhemery.com/DHE-Modules/panelgen/internal/control"
+	"dhemery.com/DHE-Modules/panelgen/internal/svg"
+)
+
+// A truth panel whose outcomes are edited in a grid instead of a column of
+// steppers. The first half of the inputs select the grid row, and the rest
+// select the grid column.
+func init() {
+	grids := []truthGrid{
+		{inputNames: []string{"A", "B", "C", "D", "E"}},
+		{inputNames: []string{"A", "B", "C", "D", "E", "F"}},
+	}
+	for _, t := range grids {
+		registerBuilder(t.slug(), t.build)
+	}
+}
+
+const (
+	truthGridHp       = Hp(18)
+	truthGridCellSize = mmPerHp
+	truthGridLeft     = 8.0 * mmPerHp
+	truthGridTop      = 40.0
+	truthGridInputX   = 2.0 * mmPerHp
+	truthGridInputTop = 29.36
+	truthGridPortDy   = 14.585
+	truthGridOutputY  = truthGridInputTop + 5.0*truthGridPortDy
+)
+
+type truthGrid struct {
+	inputNames []string
+}
+
+func (t truthGrid) slug() string { return fmt.Sprintf("truth-%d", len(t.inputNames)) }
+
+func (t truthGrid) name() string { return fmt.Sprintf("TRUTH %d", len(t.inputNames)) }
+
+func (t truthGrid) build() *Panel {
+	const (
+		hue = 240
+	)
+	var (
+		bg = svg.HslColor(hue, 1, .97)
+		fg = svg.HslColor(hue, 1, .3)
+	)
+
+	p := NewPanel(t.name(), truthGridHp, fg, bg, "truth")
+
+	nInputs := len(t.inputNames)
+	for i := 0; i < nInputs-1; i++ {
+		truthInButtonPort(p, truthGridInputX, truthGridInputTop+float64(i)*truthGridPortDy, t.inputNames[i])
+	}
+	gateInputName := fmt.Sprintf("    %s/GATE", t.inputNames[nInputs-1])
+	truthInButtonPort(p, truthGridInputX, truthGridInputTop+float64(nInputs-1)*truthGridPortDy, gateInputName)
+
+	var (
+		rowBits    = (nInputs + 1) / 2
+		columnBits = nInputs - rowBits
+		nRows      = 1 << rowBits
+		nColumns   = 1 << columnBits
+		cell       = truthGridCellSize
+		gridRight  = truthGridLeft + float64(nColumns)*cell
+		gridBottom = truthGridTop + float64(nRows)*cell
+		headerTop  = truthGridTop - float64(columnBits)*cell
+		labelsLeft = truthGridLeft - float64(rowBits)*cell
+		trueLabel  = svg.TextCentered("T", svg.LargeFont, fg)
+		falseLabel = svg.TextCentered("F", svg.LargeFont, fg)
+	)
+	bitLabel := func(bits, bit int) svg.Text {
+		if (bits>>bit)&1 == 1 {
+			return trueLabel
+		}
+		return falseLabel
+	}
+
+	// Each column's state of the column inputs, one header row per input
+	p.Engrave(truthGridLeft, headerTop, svg.Rect{
+		W:           float64(nColumns) * cell,
+		H:           float64(columnBits) * cell,
+		Stroke:      fg,
+		StrokeWidth: strokeWidth,
+		Fill:        bg,
+	})
+	for j := 0; j < columnBits; j++ {
+		y := headerTop + (float64(j)+0.5)*cell
+		for c := 0; c < nColumns; c++ {
+			x := truthGridLeft + (float64(c)+0.5)*cell
+			p.Engrave(x, y, bitLabel(c, columnBits-1-j))
+		}
+		input := rowBits + j
+		nameX := gridRight + cell
+		if input < nInputs-1 {
+			p.Engrave(nameX, y, svg.TextCentered(t.inputNames[input], svg.LargeFont, fg))
+		}
+	}
+	gateModes := []string{"RISE", "FALL", "EDGE", "HIGH", "LOW"}
+	gateModeStepper := control.Stepper("gate-mode", fg, bg, svg.LargeFont, 9, 4, gateModes)
+	p.Install(gridRight+cell, truthGridTop-0.5*cell, gateModeStepper)
+
+	// Each row's state of the row inputs, one label column per input
+	p.Engrave(labelsLeft, truthGridTop, svg.Rect{
+		W:           float64(rowBits) * cell,
+		H:           float64(nRows) * cell,
+		Stroke:      fg,
+		StrokeWidth: strokeWidth,
+		Fill:        bg,
+	})
+	for i := 0; i < rowBits; i++ {
+		x := labelsLeft + (float64(i)+0.5)*cell
+		p.Engrave(x, truthGridTop-0.5*cell, svg.TextCentered(t.inputNames[i], svg.LargeFont, fg))
+		for r := 0; r < nRows; r++ {
+			y := truthGridTop + (float64(r)+0.5)*cell
+			p.Engrave(x, y, bitLabel(r, rowBits-1-i))
+		}
+	}
+
+	// The outcome cells
+	p.Engrave(truthGridLeft, truthGridTop, svg.Rect{
+		W:           float64(nColumns) * cell,
+		H:           float64(nRows) * cell,
+		Stroke:      fg,
+		StrokeWidth: strokeWidth,
+		Fill:        fg,
+	})
+	outcomes := []string{"T", "F", "Q", "¬Q"}
+	outcomeCell := control.Stepper("outcome-cell", fg, bg, svg.SmallFont, cell-1.0, 1, outcomes)
+	for r := 0; r < nRows; r++ {
+		for c := 0; c < nColumns; c++ {
+			x := truthGridLeft + (float64(c)+0.5)*cell
+			y := truthGridTop + (float64(r)+0.5)*cell
+			p.Install(x, y, outcomeCell)
+		}
+	}
+	p.HLine(labelsLeft, gridRight, gridBottom)
+
+	truthOutButtonPort(p, 12.0*mmPerHp, truthGridOutputY, "Q")
+	truthOutButtonPort(p, 16.0*mmPerHp, truthGridOutputY, "¬ Q")
+	return p
+}
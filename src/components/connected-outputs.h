@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+
+namespace dhe {
+
+/**
+ * Keeps the subset of a module's output writers whose outputs are connected,
+ * so that the module can compute and write only the outputs that someone is
+ * listening to. Each writer must name its output in an output_id_ member.
+ * Connections change only when the user connects or disconnects a cable, so
+ * the module invalidates the subset only then (in onPortChange), and the next
+ * update rebuilds it. Iterating over the subset costs nothing for the outputs
+ * that are not connected.
+ */
+template <typename Writer, int N> class ConnectedOutputs {
+public:
+  /**
+   * Marks the subset as stale, so that the next update rebuilds it.
+   */
+  void invalidate() { is_stale_ = true; }
+
+  /**
+   * Rebuilds the subset from the writers whose outputs are connected, if the
+   * subset is stale.
+   */
+  template <typename Outputs>
+  void update(Outputs const &outputs, std::array<Writer, N> const &writers) {
+    if (!is_stale_) {
+      return;
+    }
+    is_stale_ = false;
+    count_ = 0;
+    ids_ = 0U;
+    for (auto const &writer : writers) {
+      if (outputs[writer.output_id_].isConnected()) {
+        connected_[count_++] = writer;
+        ids_ |= 1U << writer.output_id_;
+      }
+    }
+  }
+
+  auto begin() const -> Writer const * { return connected_.data(); }
+  auto end() const -> Writer const * { return connected_.data() + count_; }
+  auto size() const -> int { return count_; }
+
+  // Whether the subset includes the writer of the output. Output ids must be
+  // less than 32.
+  auto contains(int output_id) const -> bool {
+    return (ids_ & (1U << output_id)) != 0U;
+  }
+
+private:
+  std::array<Writer, N> connected_{};
+  int count_{0};
+  unsigned int ids_{0U};
+  bool is_stale_{true};
+};
+} // namespace dhe
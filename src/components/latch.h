@@ -10,9 +10,17 @@ public:
   constexpr Latch() = default;
   constexpr Latch(bool state, bool edge) : state_{state}, edge_{edge} {}
 
-  void clock(bool signal) {
+  void clock(bool signal) { clock(signal, 1.F); }
+
+  /**
+   * Clocks the latch with a signal and an estimate of the portion of the
+   * sample period that followed the signal's change of state. The estimate is
+   * retained only if the signal produces an edge.
+   */
+  void clock(bool signal, float edge_fraction) {
     edge_ = signal != state_;
     state_ = signal;
+    edge_fraction_ = edge_ ? edge_fraction : 1.F;
   }
 
   constexpr auto is_high() const -> bool { return state_; };
@@ -22,6 +30,13 @@ public:
   constexpr auto is_fall() const -> bool { return is_edge() && is_low(); };
   constexpr auto is_rise() const -> bool { return is_edge() && is_high(); };
 
+  /**
+   * The portion of the most recent sample period that followed the edge, from
+   * 0 (the edge happened at the end of the period) to 1 (the edge happened at
+   * the start of the period, or its timing is unknown).
+   */
+  constexpr auto edge_fraction() const -> float { return edge_fraction_; }
+
   constexpr auto operator==(Latch const &rhs) const -> bool {
     return state_ == rhs.state_ && edge_ == rhs.edge_;
   }
@@ -32,6 +47,7 @@ public:
 private:
   bool state_{};
   bool edge_{};
+  float edge_fraction_{1.F};
 };
 
 namespace latch {
@@ -42,6 +58,20 @@ static auto constexpr low = Latch{false, false};
 
 static auto constexpr values = std::array<Latch, 4>{low, high, falling, rising};
 
+/**
+ * Estimates the portion of the sample period that followed a signal's crossing
+ * of the threshold, assuming the signal moved linearly from the previous
+ * sample to the current one. If the signal did not cross the threshold, the
+ * estimate is 1.
+ */
+static inline auto edge_fraction(float previous, float current,
+                                 float threshold) -> float {
+  if ((previous > threshold) == (current > threshold)) {
+    return 1.F;
+  }
+  return (current - threshold) / (current - previous);
+}
+
 static auto constexpr name(Latch l) -> char const * {
   return l.is_high() ? (l.is_edge() ? "Rising" : "High")
                      : (l.is_edge() ? "Falling" : "Low");
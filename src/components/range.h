@@ -20,6 +20,11 @@ public:
     return cx::scale(proportion, lower_, upper_);
   }
 
+  // Scales each lane of a SIMD vector (such as rack::simd::float_4).
+  template <typename T> auto scale(T proportion) const -> T {
+    return proportion * size() + lower_;
+  }
+
   constexpr auto scale(bool state) const -> float {
     return state ? upper_ : lower_;
   }
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace dhe {
+// Rack's default engine sample rate. Modules assume this rate until Rack
+// reports the actual rate.
+static auto constexpr default_sample_rate = 44100.F;
+static auto constexpr default_sample_time = 1.F / default_sample_rate;
+} // namespace dhe
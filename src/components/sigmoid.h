@@ -2,6 +2,8 @@
 
 #include "cxmath.h"
 
+#include <cmath>
+
 namespace dhe {
 namespace sigmoid {
 /**
@@ -23,5 +25,16 @@ static constexpr auto curve(float input, float curvature) -> float {
   return (input - input * curvature) /
          (curvature - cx::abs(input) * 2.0F * curvature + 1.0F);
 }
+
+/**
+ * Applies the sigmoid function to each lane of a SIMD vector (such as
+ * rack::simd::float_4).
+ */
+template <typename T> static inline auto curve(T input, T curvature) -> T {
+  // Rack's SIMD vectors overload abs in their own namespace.
+  using std::abs;
+  return (input - input * curvature) /
+         (curvature - abs(input) * 2.0F * curvature + 1.0F);
+}
 } // namespace sigmoid
 } // namespace dhe
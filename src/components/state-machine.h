@@ -0,0 +1,92 @@
+#pragma once
+
+#include <type_traits>
+
+namespace dhe {
+
+/**
+ * A tag that names one state of a state machine, so that an owner can
+ * overload its state handlers by state id.
+ */
+template <typename Id, Id I> using State = std::integral_constant<Id, I>;
+
+/**
+ * Dispatches to the handlers for the current state of an owner. For each
+ * listed state id I, the owner must define:
+ *
+ *   void enter(State<Id, I>);
+ *   void exit(State<Id, I>);
+ *   void execute(State<Id, I>, float sample_time);
+ *
+ * The machine generates a table of those handlers at compile time, and keeps
+ * a pointer to the current state's entry. Executing the current state is
+ * then a single indirect call, with no switch on the state id. Looking up a
+ * state by id happens only on a transition. If the handlers are private, the
+ * owner must befriend the machine.
+ */
+template <typename Owner, typename Id, Id... Ids> class StateMachine {
+  struct Handlers {
+    Id id_;                           // NOLINT
+    void (*enter_)(Owner &);          // NOLINT
+    void (*exit_)(Owner &);           // NOLINT
+    void (*execute_)(Owner &, float); // NOLINT
+  };
+
+public:
+  /**
+   * Starts the machine in the initial state, without entering it.
+   */
+  explicit StateMachine(Id initial) : state_{&handlers_for(initial)} {}
+
+  auto id() const -> Id { return state_->id_; }
+
+  /**
+   * Exits the current state and enters the state with the given id, which
+   * must be one of the machine's listed ids.
+   */
+  void enter(Owner &owner, Id id) {
+    state_->exit_(owner);
+    state_ = &handlers_for(id);
+    state_->enter_(owner);
+  }
+
+  void execute(Owner &owner, float sample_time) {
+    state_->execute_(owner, sample_time);
+  }
+
+private:
+  template <Id I> static void enter_state(Owner &owner) {
+    owner.enter(State<Id, I>{});
+  }
+
+  template <Id I> static void exit_state(Owner &owner) {
+    owner.exit(State<Id, I>{});
+  }
+
+  template <Id I> static void execute_state(Owner &owner, float sample_time) {
+    owner.execute(State<Id, I>{}, sample_time);
+  }
+
+  template <Id I> static auto handlers() -> Handlers const & {
+    static auto const handlers =
+        Handlers{I, &enter_state<I>, &exit_state<I>, &execute_state<I>};
+    return handlers;
+  }
+
+  template <Id First, Id... Rest> struct Lookup {
+    static auto find(Id id) -> Handlers const & {
+      return id == First ? handlers<First>() : Lookup<Rest...>::find(id);
+    }
+  };
+
+  template <Id Last> struct Lookup<Last> {
+    static auto find(Id /*id*/) -> Handlers const & { return handlers<Last>(); }
+  };
+
+  static auto handlers_for(Id id) -> Handlers const & {
+    return Lookup<Ids...>::find(id);
+  }
+
+  Handlers const *state_;
+};
+} // namespace dhe
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "sample-rate.h"
+
+namespace dhe {
+
+/**
+ * Permits an action on only one of every <em>interval</em> ticks. Useful for
+ * limiting how often a module updates values that change every sample but that
+ * the user can observe only at UI frame rate, such as light brightness.
+ */
+class Throttle {
+public:
+  constexpr Throttle(int interval = 1) : interval_{interval} {}
+
+  /**
+   * Advances the throttle by one tick. The first tick is always permitted.
+   * @return whether the action is permitted on this tick
+   */
+  auto tick() -> bool {
+    if (ticks_ > 0) {
+      ticks_--;
+      return false;
+    }
+    ticks_ = interval_ - 1;
+    return true;
+  }
+
+  /**
+   * Sets the interval, which takes effect after the next permitted tick.
+   */
+  void set_interval(int interval) { interval_ = interval; }
+
+private:
+  int interval_;
+  int ticks_{0};
+};
+
+// Modules update their lights once every 64 samples at Rack's default sample
+// rate, and at about the same rate (in Hz) at every other sample rate.
+static auto constexpr light_update_interval = 64;
+static auto constexpr light_update_rate =
+    default_sample_rate / static_cast<float>(light_update_interval);
+
+static inline auto light_update_interval_at(float sample_rate) -> int {
+  auto const interval = static_cast<int>(sample_rate / light_update_rate);
+  return interval < 1 ? 1 : interval;
+}
+
+} // namespace dhe
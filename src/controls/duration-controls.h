@@ -1,5 +1,6 @@
 #pragma once
 
+#include "options.h"
 #include "switches.h"
 
 #include "panels/assets.h"
@@ -8,6 +9,7 @@
 #include "rack.hpp"
 
 #include <string>
+#include <vector>
 
 namespace dhe {
 struct MediumDurationKnob {
@@ -36,17 +38,24 @@ struct MediumDurationKnob {
 struct DurationKnob {
   struct Quantity : rack::engine::ParamQuantity {
     auto getDisplayValue() -> float override {
-      return Duration::scale(getValue(), range_id_);
+      return Duration::scale(getValue(), effective_range_id());
     }
 
     void setDisplayValue(float display) override {
-      setValue(Duration::normalize(display, range_id_));
+      setValue(Duration::normalize(display, effective_range_id()));
     }
 
     void select_range(DurationRangeId id) { range_id_ = id; }
 
+    void select_micro(bool micro) { micro_ = micro; }
+
   private:
+    auto effective_range_id() const -> DurationRangeId {
+      return micro_ ? DurationRangeId::Micro : range_id_;
+    }
+
     DurationRangeId range_id_{};
+    bool micro_{false};
   };
 
   static auto
@@ -106,4 +115,39 @@ struct DurationRangeSwitch {
     return q;
   }
 };
+
+// A context menu option that overrides a stage's duration range with the
+// micro range, for audio rate stages.
+struct MicroDurationOption {
+  struct Quantity : rack::engine::SwitchQuantity {
+    void setValue(float value) override {
+      rack::engine::SwitchQuantity::setValue(value);
+      for (auto *knob : knobs_) {
+        knob->select_micro(value > 0.5F);
+      }
+    }
+
+    void add_knob(DurationKnob::Quantity *knob) {
+      knobs_.push_back(knob);
+      knob->select_micro(getValue() > 0.5F);
+    }
+
+  private:
+    std::vector<DurationKnob::Quantity *> knobs_{};
+  };
+
+  static inline auto config(rack::engine::Module *module, int param_id)
+      -> Quantity * {
+    return MenuOption::config<Quantity>(
+        module, param_id, "Micro durations",
+        {"Off", std::string{"On ("} + duration::micro_label + ")"});
+  }
+
+  static inline void install(rack::ui::Menu *menu,
+                             rack::engine::Module *module, int param_id) {
+    MenuOption::install(menu, module, param_id,
+                        std::string{"Micro durations ("} +
+                            duration::micro_label + ")");
+  }
+};
 } // namespace dhe
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "rack.hpp"
+
+#include <string>
+#include <vector>
+
+namespace dhe {
+
+// An on/off param with no panel control, set by a context menu item. The menu
+// item sets the param through its quantity, so that the quantity can react to
+// the change, and records the change in the undo history.
+struct MenuOption {
+  template <typename Quantity = rack::engine::SwitchQuantity>
+  static inline auto config(rack::engine::Module *module, int param_id,
+                            std::string const &name,
+                            std::vector<std::string> const &labels)
+      -> Quantity * {
+    auto *q = module->configSwitch<Quantity>(param_id, 0.F, 1.F, 0.F, name,
+                                             labels);
+    q->randomizeEnabled = false;
+    return q;
+  }
+
+  static inline void install(rack::ui::Menu *menu,
+                             rack::engine::Module *module, int param_id,
+                             std::string const &text) {
+    if (module == nullptr) {
+      return;
+    }
+    auto *q = module->getParamQuantity(param_id);
+    menu->addChild(new rack::ui::MenuSeparator{});
+    menu->addChild(rack::createBoolMenuItem(
+        text, "", [q]() -> bool { return q->getValue() > 0.5F; },
+        [q](bool on) { set(q, on ? 1.F : 0.F); }));
+  }
+
+private:
+  static inline void set(rack::engine::ParamQuantity *q, float new_value) {
+    auto const old_value = q->getValue();
+    if (new_value == old_value) {
+      return;
+    }
+    q->setValue(new_value);
+
+    auto *change = new rack::history::ParamChange;
+    change->name = "set " + q->name;
+    change->moduleId = q->module->id;
+    change->paramId = q->paramId;
+    change->oldValue = old_value;
+    change->newValue = new_value;
+    APP->history->push(change);
+  }
+};
+} // namespace dhe
@@ -2,6 +2,8 @@
 
 #include "app/SvgSwitch.hpp"
 #include "engine/ParamQuantity.hpp"
+#include "options.h"
+#include "signals/basic.h"
 #include "signals/shape-signals.h"
 #include "switches.h"
 
@@ -80,4 +82,19 @@ struct ShapeStepper {
     return w;
   }
 };
+
+// A context menu option that chooses whether a stage reads its curve
+// controls every sample, or only when the stage is triggered.
+struct CurveLatchOption {
+  static inline auto config(rack::engine::Module *module, int param_id)
+      -> rack::engine::SwitchQuantity * {
+    return MenuOption::config(module, param_id, "Curve controls",
+                              {"Modulatable", "Latched at trigger"});
+  }
+
+  static inline void install(rack::ui::Menu *menu,
+                             rack::engine::Module *module, int param_id) {
+    MenuOption::install(menu, module, param_id, "Latch curve at trigger");
+  }
+};
 } // namespace dhe
\ No newline at end of file
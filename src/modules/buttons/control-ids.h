@@ -18,6 +18,8 @@ struct ParamId {
 struct OutputId {
   enum {
     MULTIPLE(Out, button_count),
+    All,
+    NegatedAll,
     Count,
   };
 };
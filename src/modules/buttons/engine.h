@@ -0,0 +1,39 @@
+#pragma once
+
+#include "control-ids.h"
+
+#include "signals/basic.h"
+
+#include <vector>
+
+namespace dhe {
+namespace buttons {
+
+// Sends each button's voltage to its own output and as a channel of the ALL
+// output, and sends its negation as a channel of the ¬ALL output.
+template <typename TParam, typename TOutput> class Engine {
+public:
+  Engine(std::vector<TParam> const &params, std::vector<TOutput> &outputs)
+      : params_{params}, outputs_{outputs} {}
+
+  void process() {
+    auto &all = outputs_[OutputId::All];
+    auto &negated_all = outputs_[OutputId::NegatedAll];
+    all.setChannels(button_count);
+    negated_all.setChannels(button_count);
+    for (int i = 0; i < button_count; i++) {
+      auto const button_is_pressed = is_pressed(params_[ParamId::Button + i]);
+      auto const negate_is_pressed = is_pressed(params_[ParamId::Negate + i]);
+      auto const out = button_is_pressed == negate_is_pressed ? 0.F : 10.F;
+      outputs_[OutputId::Out + i].setVoltage(out);
+      all.setVoltage(out, i);
+      negated_all.setVoltage(10.F - out, i);
+    }
+  }
+
+private:
+  std::vector<TParam> const &params_;
+  std::vector<TOutput> &outputs_;
+};
+} // namespace buttons
+} // namespace dhe
@@ -1,10 +1,10 @@
 #pragma once
 
-#include "components/range.h"
 #include "control-ids.h"
+#include "engine.h"
+
 #include "controls/buttons.h"
 #include "params/presets.h"
-#include "signals/basic.h"
 
 #include "rack.hpp"
 
@@ -24,16 +24,11 @@ struct Module : rack::engine::Module {
       Button::config(this, ParamId::Negate + i, "Negate " + row_names[i]);
       configOutput(OutputId::Out + i, row_names[i]);
     }
+    configOutput(OutputId::All, "All buttons");
+    configOutput(OutputId::NegatedAll, "All buttons negated");
   }
 
-  void process(ProcessArgs const & /*args*/) override {
-    for (int i = 0; i < button_count; i++) {
-      auto const button_is_pressed = is_pressed(params[ParamId::Button + i]);
-      auto const negate_is_pressed = is_pressed(params[ParamId::Negate + i]);
-      auto const out = button_is_pressed == negate_is_pressed ? 0.F : 10.F;
-      outputs[OutputId::Out + i].setVoltage(out);
-    }
-  }
+  void process(ProcessArgs const & /*args*/) override { engine_.process(); }
 
   auto dataToJson() -> json_t * override {
     auto *data = json_object();
@@ -42,6 +37,7 @@ struct Module : rack::engine::Module {
   }
 
 private:
+  Engine<rack::engine::Param, rack::engine::Output> engine_{params, outputs};
 };
 } // namespace buttons
 } // namespace dhe
@@ -23,7 +23,7 @@ struct Panel : public PanelWidget<Panel> {
     auto constexpr port_x = negate_x + 7.7F;
 
     auto constexpr top = 21.F;
-    auto constexpr dy = 12.7F;
+    auto constexpr dy = 11.F;
 
     for (int i = 0; i < button_count; i++) {
       auto const y = top + static_cast<float>(i) * dy;
@@ -31,6 +31,14 @@ struct Panel : public PanelWidget<Panel> {
       Button::install<Momentary>(this, ParamId::Negate + i, negate_x, y);
       OutPort::install(this, OutputId::Out + i, port_x, y);
     }
+
+    // The ¬ALL port sits left of the negate column, so that its labeled box
+    // clears the ALL port's box.
+    auto constexpr negated_all_shift = 5.F;
+    auto constexpr negated_all_x = negate_x - negated_all_shift;
+    auto constexpr all_y = top + static_cast<float>(button_count) * dy;
+    OutPort::install(this, OutputId::NegatedAll, negated_all_x, all_y);
+    OutPort::install(this, OutputId::All, port_x, all_y);
   }
 };
 } // namespace buttons
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "polynomial.h"
+
+#define MULTIPLE(name, n) name, name##_LAST = (name) + (n)-1
+
+namespace dhe {
+namespace cubic {
+namespace chebyshev {
+struct ParamId {
+  enum {
+    MULTIPLE(Weight, harmonic_count),
+    InputGain,
+    OutputGain,
+    Count,
+  };
+};
+
+struct InputId {
+  enum {
+    Chebyshev,
+    MULTIPLE(WeightCv, harmonic_count),
+    InputGainCv,
+    OutputGainCv,
+    Count,
+  };
+};
+
+struct OutputId {
+  enum { Chebyshev, Count };
+};
+
+} // namespace chebyshev
+} // namespace cubic
+} // namespace dhe
+
+#undef MULTIPLE
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "control-ids.h"
+#include "polynomial.h"
+
+#include "modules/cubic/coefficient.h"
+#include "modules/cubic/controls.h"
+
+#include "controls/knobs.h"
+#include "params/presets.h"
+#include "signals/basic.h"
+#include "signals/linear-signals.h"
+
+#include "rack.hpp"
+
+#include <string>
+
+namespace dhe {
+namespace cubic {
+namespace chebyshev {
+
+struct Module : public rack::engine::Module {
+  using float_4 = rack::simd::float_4;
+
+  Module() {
+    config(ParamId::Count, InputId::Count, OutputId::Count);
+
+    for (auto k = 0; k < harmonic_count; k++) {
+      auto const name = "T" + std::to_string(k + 1) + " weight";
+      // Start as the identity: all of T1 and none of the other harmonics
+      CoefficientKnob::config(this, ParamId::Weight + k, name,
+                              k == 0 ? 1.F : 0.F);
+      configInput(InputId::WeightCv + k, name + " CV");
+    }
+
+    GainKnob::config(this, ParamId::InputGain, "Input gain");
+    configInput(InputId::InputGainCv, "Input gain CV");
+
+    GainKnob::config(this, ParamId::OutputGain, "Output gain");
+    configInput(InputId::OutputGainCv, "Output gain CV");
+
+    configInput(InputId::Chebyshev, "Chebyshev");
+    configOutput(OutputId::Chebyshev, "Chebyshev");
+  }
+
+  void process(ProcessArgs const & /*args*/) override {
+    auto const poly_weights = has_poly_weights();
+    if (!poly_weights) {
+      auto weights = Weights{};
+      for (auto k = 0; k < harmonic_count; k++) {
+        weights[k] = weight(k);
+      }
+      polynomial_.set_weights(weights);
+    }
+
+    auto const &in = inputs[InputId::Chebyshev];
+    auto &out = outputs[OutputId::Chebyshev];
+    auto const channels = channel_count(inputs);
+    out.setChannels(channels);
+    for (auto c = 0; c < channels; c += float_4::size) {
+      auto const input_gain = gain(ParamId::InputGain, InputId::InputGainCv, c);
+      auto const output_gain =
+          gain(ParamId::OutputGain, InputId::OutputGainCv, c);
+      auto const x = voltages_at<float_4>(in, c) * input_gain * 0.2F;
+      auto const y = poly_weights ? Polynomial::evaluate(weights(c), x)
+                                  : polynomial_(x);
+      out.setVoltageSimd(y * output_gain * 5.F, c);
+    }
+  }
+
+  auto dataToJson() -> json_t * override {
+    auto *data = json_object();
+    json_object_set_new(data, preset_version_key, json_integer(0));
+    return data;
+  }
+
+private:
+  // Whether any weight CV carries more than one channel. If none does, every
+  // channel shares one set of weights, and so one set of coefficients.
+  auto has_poly_weights() const -> bool {
+    for (auto k = 0; k < harmonic_count; k++) {
+      if (inputs[InputId::WeightCv + k].getChannels() > 1) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  auto weight(int k) const -> float {
+    auto const rotation =
+        rotation_of(params[ParamId::Weight + k], inputs[InputId::WeightCv + k]);
+    return Coefficient::scale(rotation);
+  }
+
+  auto weights(int channel) const -> LaneWeights<float_4> {
+    auto lane_weights = LaneWeights<float_4>{};
+    for (auto k = 0; k < harmonic_count; k++) {
+      auto const rotation = rotations_of<float_4>(
+          params[ParamId::Weight + k], inputs[InputId::WeightCv + k], channel);
+      lane_weights[k] = Coefficient::range.scale(rotation);
+    }
+    return lane_weights;
+  }
+
+  auto gain(int knob_id, int cv_id, int channel) const -> float_4 {
+    auto const rotation =
+        rotations_of<float_4>(params[knob_id], inputs[cv_id], channel);
+    return Gain::range.scale(rotation);
+  }
+
+  Polynomial polynomial_{};
+};
+} // namespace chebyshev
+} // namespace cubic
+} // namespace dhe
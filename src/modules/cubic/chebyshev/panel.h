@@ -0,0 +1,56 @@
+#pragma once
+
+#include "control-ids.h"
+
+#include "controls/knobs.h"
+#include "controls/ports.h"
+#include "panels/panel-widget.h"
+
+#include "rack.hpp"
+
+namespace dhe {
+namespace cubic {
+namespace chebyshev {
+
+struct Panel : public PanelWidget<Panel> {
+  static auto constexpr hp = 10;
+  static auto constexpr panel_file = "chebyshev";
+  static auto constexpr svg_dir = "chebyshev";
+
+  Panel(rack::engine::Module *module) : PanelWidget<Panel>{module} {
+    auto constexpr width = hp2mm(hp);
+    auto constexpr dx = width / 4.F;
+    auto constexpr column1 = dx / 2.F;
+    auto constexpr column2 = column1 + dx;
+    auto constexpr column3 = column2 + dx;
+    auto constexpr column4 = column3 + dx;
+
+    auto constexpr top = 20.F;
+    auto constexpr dy = 15.F;
+    auto constexpr rows = harmonic_count / 2;
+
+    // T1 through T4 on the left, T5 through T8 on the right
+    for (auto row = 0; row < rows; row++) {
+      auto const y = top + static_cast<float>(row) * dy;
+      InPort::install(this, InputId::WeightCv + row, column1, y);
+      Knob::install<Small>(this, ParamId::Weight + row, column2, y);
+      InPort::install(this, InputId::WeightCv + rows + row, column3, y);
+      Knob::install<Small>(this, ParamId::Weight + rows + row, column4, y);
+    }
+
+    auto y = 82.F;
+    Knob::install<Small>(this, ParamId::InputGain, column2, y);
+    Knob::install<Small>(this, ParamId::OutputGain, column3, y);
+
+    y += dy;
+    InPort::install(this, InputId::InputGainCv, column2, y);
+    InPort::install(this, InputId::OutputGainCv, column3, y);
+
+    y += dy;
+    InPort::install(this, InputId::Chebyshev, column2, y);
+    OutPort::install(this, OutputId::Chebyshev, column3, y);
+  }
+};
+} // namespace chebyshev
+} // namespace cubic
+} // namespace dhe
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+
+namespace dhe {
+namespace cubic {
+namespace chebyshev {
+static auto constexpr harmonic_count = 8;
+
+using Weights = std::array<float, harmonic_count>;
+
+// The weights of the harmonics in each lane of a SIMD vector V.
+template <typename V> using LaneWeights = std::array<V, harmonic_count>;
+
+/**
+ * A weighted sum of the Chebyshev polynomials T1 through T8. Driving Tk with
+ * a full-scale sine yields the sine's kth harmonic, so each weight sets the
+ * level of one harmonic. The sum is kept as the coefficients of one ordinary
+ * polynomial, which are recomputed only when the weights change, and which
+ * each sample evaluates by Horner's method.
+ */
+class Polynomial {
+public:
+  static auto constexpr degree = harmonic_count;
+
+  /**
+   * Sets the weight of each harmonic, where weights[k] is the weight of
+   * T(k+1).
+   */
+  void set_weights(Weights const &weights) {
+    if (weights == weights_) {
+      return;
+    }
+    weights_ = weights;
+    sum(weights_, coefficients_);
+  }
+
+  /**
+   * Evaluates the polynomial for one voice (V = float) or a lane of voices
+   * (V = a SIMD vector such as rack::simd::float_4). The input is clamped to
+   * [-1, 1], beyond which the Chebyshev polynomials grow steeply.
+   */
+  template <typename V> auto operator()(V x) const -> V {
+    return horner(coefficients_, x);
+  }
+
+  /**
+   * Evaluates the polynomial for a lane of voices whose weights differ from
+   * lane to lane. This sums the coefficients on every call, so use it only
+   * when the weights are polyphonic.
+   */
+  template <typename V>
+  static auto evaluate(LaneWeights<V> const &weights, V x) -> V {
+    auto coefficients = std::array<V, degree + 1>{};
+    sum(weights, coefficients);
+    return horner(coefficients, x);
+  }
+
+  auto coefficients() const -> std::array<float, degree + 1> const & {
+    return coefficients_;
+  }
+
+private:
+  using Coefficients = std::array<float, degree + 1>;
+
+  template <typename W, typename C>
+  static void sum(W const &weights, C &coefficients) {
+    auto const &chebyshev = chebyshev_coefficients();
+    coefficients.fill(0.F);
+    for (auto k = 1; k <= degree; k++) {
+      for (auto power = 0; power <= k; power++) {
+        coefficients[power] =
+            coefficients[power] + weights[k - 1] * chebyshev[k][power];
+      }
+    }
+  }
+
+  template <typename C, typename V>
+  static auto horner(C const &coefficients, V x) -> V {
+    // Rack's SIMD vectors overload fmin and fmax in their own namespace.
+    using std::fmax;
+    using std::fmin;
+    auto const clamped = fmin(fmax(x, V{-1.F}), V{1.F});
+    auto y = V{coefficients[degree]};
+    for (auto power = degree - 1; power >= 0; power--) {
+      y = y * clamped + coefficients[power];
+    }
+    return y;
+  }
+
+  // Row k holds the coefficients of Tk, built by the recurrence
+  // T(k+1) = 2x Tk - T(k-1).
+  static auto chebyshev_coefficients()
+      -> std::array<Coefficients, degree + 1> const & {
+    static auto const table = [] {
+      auto t = std::array<Coefficients, degree + 1>{};
+      t[0][0] = 1.F;
+      t[1][1] = 1.F;
+      for (auto k = 1; k < degree; k++) {
+        for (auto power = 0; power <= degree; power++) {
+          auto const shifted = power > 0 ? 2.F * t[k][power - 1] : 0.F;
+          t[k + 1][power] = shifted - t[k - 1][power];
+        }
+      }
+      return t;
+    }();
+    return table;
+  }
+
+  Weights weights_{};
+  Coefficients coefficients_{};
+};
+} // namespace chebyshev
+} // namespace cubic
+} // namespace dhe
@@ -9,6 +9,7 @@ struct ParamId {
     DCoefficient,
     InputGain,
     OutputGain,
+    Antialias,
     Count
   };
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "coefficient.h"
+
+#include "controls/knobs.h"
+#include "controls/options.h"
+#include "signals/basic.h"
+
+#include "rack.hpp"
+
+namespace dhe {
+namespace cubic {
+
+struct CoefficientKnob : LinearKnob<CoefficientKnob> {
+  static auto constexpr default_value = 0.F;
+  static auto constexpr &range = Coefficient::range;
+  static auto constexpr unit = "";
+};
+
+struct AntialiasOption {
+  static inline void config(rack::engine::Module *module, int param_id) {
+    MenuOption::config(module, param_id, "Anti-aliasing", {"Off", "ADAA"});
+  }
+
+  static inline void install(rack::ui::Menu *menu,
+                             rack::engine::Module *module, int param_id) {
+    MenuOption::install(menu, module, param_id, "Anti-aliasing (ADAA)");
+  }
+};
+} // namespace cubic
+} // namespace dhe
@@ -1,4 +1,6 @@
 #include "init.h"
+#include "chebyshev/module.h"
+#include "chebyshev/panel.h"
 #include "module.h"
 #include "panel.h"
 
@@ -8,6 +10,8 @@ namespace dhe {
 namespace cubic {
 void init(rack::plugin::Plugin *plugin) {
   plugin->addModel(rack::createModel<Module, Panel>("Cubic"));
+  plugin->addModel(
+      rack::createModel<chebyshev::Module, chebyshev::Panel>("Chebyshev"));
 }
 } // namespace cubic
 } // namespace dhe
@@ -2,6 +2,8 @@
 
 #include "coefficient.h"
 #include "control-ids.h"
+#include "controls.h"
+#include "shaper.h"
 
 #include "components/range.h"
 #include "controls/knobs.h"
@@ -15,12 +17,6 @@ namespace dhe {
 
 namespace cubic {
 
-struct CoefficientKnob : LinearKnob<CoefficientKnob> {
-  static auto constexpr default_value = 0.F;
-  static auto constexpr &range = Coefficient::range;
-  static auto constexpr unit = "";
-};
-
 struct Module : public rack::engine::Module {
   Module() {
     config(ParamId::Count, InputId::Count, OutputId::Count);
@@ -47,6 +43,8 @@ struct Module : public rack::engine::Module {
 
     configInput(InputId::Cubic, "Module");
     configOutput(OutputId::Cubic, "Module");
+
+    AntialiasOption::config(this, ParamId::Antialias);
   }
 
   void process(ProcessArgs const & /*args*/) override {
@@ -57,10 +55,15 @@ struct Module : public rack::engine::Module {
     auto input_gain = gain(ParamId::InputGain, InputId::InputGainCv);
     auto output_gain = gain(ParamId::OutputGain, InputId::OutputGainCv);
 
+    auto const cubic = Polynomial{a, b, c, d};
     auto x = input_gain * main_in() * 0.2F;
-    auto x2 = x * x;
-    auto x3 = x2 * x;
-    auto y = a * x3 + b * x2 + c * x + d;
+    auto y = 0.F;
+    if (is_pressed(params[ParamId::Antialias])) {
+      y = shaper_.apply(cubic, x);
+    } else {
+      y = cubic(x);
+      shaper_.skip(x);
+    }
     auto output_voltage = output_gain * y * 5.F;
     send_main_out(output_voltage);
   }
@@ -87,6 +90,8 @@ private:
   void send_main_out(float voltage) {
     outputs[OutputId::Cubic].setVoltage(voltage);
   }
+
+  AntialiasedShaper shaper_{};
 };
 } // namespace cubic
 } // namespace dhe
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "control-ids.h"
+#include "controls.h"
 
 #include "controls/knobs.h"
 #include "controls/ports.h"
@@ -53,6 +54,10 @@ struct Panel : public PanelWidget<Panel> {
     InPort::install(this, InputId::Cubic, column1, y);
     OutPort::install(this, OutputId::Cubic, column2, y);
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    AntialiasOption::install(menu, getModule(), ParamId::Antialias);
+  }
 };
 } // namespace cubic
 } // namespace dhe
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cmath>
+
+namespace dhe {
+namespace cubic {
+
+struct Polynomial {
+  float a_; // NOLINT
+  float b_; // NOLINT
+  float c_; // NOLINT
+  float d_; // NOLINT
+
+  auto operator()(float x) const -> float {
+    return ((a_ * x + b_) * x + c_) * x + d_;
+  }
+
+  // Computed in double, because the shaper divides the difference of two
+  // nearby values of the antiderivative by the small distance between them.
+  auto antiderivative(double x) const -> double {
+    return (((a_ * 0.25 * x + b_ / 3.0) * x + c_ * 0.5) * x + d_) * x;
+  }
+};
+
+/**
+ * Applies a polynomial with first-order antiderivative anti-aliasing (ADAA).
+ * Instead of the polynomial's value at each sample, the shaper yields its
+ * average over the straight line from the previous sample to the current one,
+ * computed from the difference of the antiderivative at the two samples. This
+ * suppresses much of the aliasing from the harmonics that the polynomial
+ * adds, at the cost of a half-sample delay.
+ *
+ * When the two samples are nearly equal, the difference quotient loses its
+ * precision, so the shaper instead yields the polynomial's value at their
+ * midpoint.
+ *
+ * The shaper must see every sample, even while anti-aliasing is off, so that
+ * turning it on does not average over the step from a stale sample.
+ */
+class AntialiasedShaper {
+public:
+  auto apply(Polynomial const &f, float x) -> float {
+    auto const x1 = previous_x_;
+    previous_x_ = x;
+    auto const dx = static_cast<double>(x) - static_cast<double>(x1);
+    if (std::abs(dx) < ill_conditioned_dx) {
+      return f(0.5F * (x + x1));
+    }
+    // Evaluate both antiderivatives with the current coefficients, so that
+    // moving a knob does not leave a stale term in the difference.
+    return static_cast<float>((f.antiderivative(x) - f.antiderivative(x1)) /
+                              dx);
+  }
+
+  // Records a sample that is not shaped, while anti-aliasing is off.
+  void skip(float x) { previous_x_ = x; }
+
+private:
+  static auto constexpr ill_conditioned_dx = 1e-5;
+  float previous_x_{};
+};
+} // namespace cubic
+} // namespace dhe
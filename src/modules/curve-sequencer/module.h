@@ -97,6 +97,10 @@ template <int N> struct Module : rack::engine::Module {
     engine_.execute(args.sampleTime);
   }
 
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    signals_.on_sample_rate_change(e.sampleRate);
+  }
+
 private:
   using SignalsType = Signals<rack::engine::Param, rack::engine::Input,
                               rack::engine::Output, rack::engine::Light, N>;
@@ -4,6 +4,7 @@
 #include "control-ids.h"
 #include "generate-mode.h"
 
+#include "components/throttle.h"
 #include "signals/basic.h"
 #include "signals/duration-signals.h"
 #include "signals/shape-signals.h"
@@ -96,9 +97,19 @@ struct Signals {
     return static_cast<int>(value_of(params_[ParamId::SelectionLength]));
   }
 
+  void on_sample_rate_change(float sample_rate) {
+    light_throttle_.set_interval(light_update_interval_at(sample_rate));
+  }
+
   void show_inactive(int step) { set_lights(step, 0.F, 0.F); }
 
   void show_progress(int step, float progress) {
+    // Always show the start and end of a step. Between those, update the
+    // lights only as often as the UI can show them.
+    auto const is_boundary = progress <= 0.F || progress >= 1.F;
+    if (!light_throttle_.tick() && !is_boundary) {
+      return;
+    }
     // Skew the progress::brightness ratio so that the "remaining" light stays
     // fully lit for a little while during early progress, and the "completed"
     // light reaches fully lit a little while before progress is complete.
@@ -124,6 +135,7 @@ private:
   std::vector<TInput> &inputs_;
   std::vector<TOutput> &outputs_;
   std::vector<TLight> &lights_;
+  Throttle light_throttle_{light_update_interval};
 };
 } // namespace curve_sequencer
 
@@ -8,6 +8,7 @@
 #include "components/latch.h"
 #include "components/phase-timer.h"
 #include "components/range.h"
+#include "components/state-machine.h"
 #include "signals/shape-signals.h"
 
 namespace dhe {
@@ -47,30 +48,12 @@ public:
   }
 
   auto execute(Latch const &gate, float sample_time) -> StepEvent {
-    GenerateMode step_mode = generate_mode();
+    auto const step_mode = generate_mode();
+    if (modes_.id() != step_mode) {
+      modes_.enter(*this, step_mode);
+    }
     if (!is_satisfied(step_mode, advance_mode(), gate)) {
-      if (step_mode != GenerateMode::Sustain) { // Sustain has no duration
-        timer_.advance(sample_time / duration());
-      }
-      signals_.show_progress(step_, timer_.phase());
-      switch (step_mode) {
-      case GenerateMode::Curve:
-        signals_.output(
-            cx::scale(taper(timer_.phase()), start_voltage_, level()));
-        break;
-      case GenerateMode::Input:
-        signals_.output(signals_.input());
-        break;
-      case GenerateMode::Chase:
-        signals_.output(
-            cx::scale(taper(timer_.phase()), start_voltage_, signals_.input()));
-        break;
-      case GenerateMode::Level:
-        signals_.output(level());
-        break;
-      default: // Hold and sustain
-        break;
-      }
+      modes_.execute(*this, sample_time);
       if (timer_.in_progress()) {
         return StepEvent::Generated;
       }
@@ -84,6 +67,55 @@ public:
   void exit() { signals_.show_inactive(step_); }
 
 private:
+  // The step's generate mode may change while the step is in progress. A
+  // change of mode carries on from the step's current phase, so entering and
+  // exiting a mode does nothing.
+  template <GenerateMode M> using Mode = State<GenerateMode, M>;
+  using Modes =
+      StateMachine<StepController, GenerateMode, GenerateMode::Curve,
+                   GenerateMode::Hold, GenerateMode::Sustain,
+                   GenerateMode::Input, GenerateMode::Chase,
+                   GenerateMode::Level>;
+  friend Modes;
+
+  template <GenerateMode M> void enter(Mode<M> /*mode*/) {}
+  template <GenerateMode M> void exit(Mode<M> /*mode*/) {}
+
+  void execute(Mode<GenerateMode::Curve> /*mode*/, float sample_time) {
+    advance(sample_time);
+    signals_.output(cx::scale(taper(timer_.phase()), start_voltage_, level()));
+  }
+
+  void execute(Mode<GenerateMode::Hold> /*mode*/, float sample_time) {
+    advance(sample_time);
+  }
+
+  // Sustain has no duration
+  void execute(Mode<GenerateMode::Sustain> /*mode*/, float /*sample_time*/) {
+    signals_.show_progress(step_, timer_.phase());
+  }
+
+  void execute(Mode<GenerateMode::Input> /*mode*/, float sample_time) {
+    advance(sample_time);
+    signals_.output(signals_.input());
+  }
+
+  void execute(Mode<GenerateMode::Chase> /*mode*/, float sample_time) {
+    advance(sample_time);
+    signals_.output(
+        cx::scale(taper(timer_.phase()), start_voltage_, signals_.input()));
+  }
+
+  void execute(Mode<GenerateMode::Level> /*mode*/, float sample_time) {
+    advance(sample_time);
+    signals_.output(level());
+  }
+
+  void advance(float sample_time) {
+    timer_.advance(sample_time / duration());
+    signals_.show_progress(step_, timer_.phase());
+  }
+
   auto advance_mode() const -> AdvanceMode {
     return signals_.advance_mode(step_);
   }
@@ -109,6 +141,7 @@ private:
 
   int step_{0};
   float start_voltage_{0.F};
+  Modes modes_{GenerateMode::Curve};
   Signals &signals_;
   PhaseTimer &timer_;
 }; // namespace curve_sequencer
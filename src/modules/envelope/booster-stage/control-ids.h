@@ -16,6 +16,8 @@ struct ParamId {
     LevelRange,
     Shape,
     Trigger,
+    LatchCurve,
+    MicroDuration,
     Count
   };
 };
@@ -2,11 +2,7 @@
 
 #include "signals.h"
 
-#include "modules/envelope/mode/defer-mode.h"
-#include "modules/envelope/mode/generate-mode.h"
-#include "modules/envelope/mode/input-mode.h"
-#include "modules/envelope/mode/level-mode.h"
-#include "modules/envelope/stage/engine.h"
+#include "modules/envelope/stage/poly-engine.h"
 
 #include "controls/buttons.h"
 #include "controls/duration-controls.h"
@@ -39,6 +35,7 @@ struct Module : public rack::engine::Module {
     CurvatureKnob::config(this, ParamId::Curvature, "Curvature");
     ShapeSwitch::config(this, ParamId::Shape, "Shape", Shape::Id::J);
     configInput(InputId::CurvatureCv, "Curvature CV");
+    CurveLatchOption::config(this, ParamId::LatchCurve);
 
     auto *duration_range_switch =
         DurationRangeSwitch::config(this, ParamId::DurationRange,
@@ -46,6 +43,8 @@ struct Module : public rack::engine::Module {
     auto *duration_knob =
         DurationKnob::config(this, ParamId::Duration, "Duration");
     duration_range_switch->add_knob(duration_knob);
+    MicroDurationOption::config(this, ParamId::MicroDuration)
+        ->add_knob(duration_knob);
     configInput(InputId::DurationCv, "Duration CV");
 
     configInput(InputId::Defer, "Defer");
@@ -60,7 +59,15 @@ struct Module : public rack::engine::Module {
   }
 
   void process(ProcessArgs const &args) override {
-    engine_.process(args.sampleTime);
+    auto const channels = channel_count(inputs);
+    for (auto &output : outputs) {
+      output.setChannels(channels);
+    }
+    engine_.process(channels, args.sampleTime);
+  }
+
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    engine_.on_sample_rate_change(e.sampleTime);
   }
 
   auto dataToJson() -> json_t * override {
@@ -70,23 +77,13 @@ struct Module : public rack::engine::Module {
   }
 
 private:
-  using RackSignals =
-      Signals<rack::engine::Param, rack::engine::Input, rack::engine::Output>;
-  using DeferMode = envelope::DeferMode<RackSignals>;
-  using InputMode = envelope::InputMode<RackSignals>;
-  using GenerateMode = envelope::GenerateMode<RackSignals, PhaseTimer>;
-  using LevelMode = envelope::LevelMode<RackSignals>;
-  using RackEngine =
-      stage::Engine<RackSignals, DeferMode, InputMode, GenerateMode, LevelMode>;
+  using float_4 = rack::simd::float_4;
+  using RackSignals = Signals<float_4, rack::engine::Param,
+                              rack::engine::Input, rack::engine::Output>;
 
   RackSignals signals_{params, inputs, outputs};
-  PhaseTimer timer_{};
-  DeferMode defer_mode_{signals_};
-  InputMode input_mode_{signals_};
-  GenerateMode generate_mode_{signals_, timer_};
-  LevelMode level_mode_{signals_};
-  RackEngine engine_{signals_, defer_mode_, input_mode_, generate_mode_,
-                     level_mode_};
+  stage::PolyEngine<float_4, RackSignals, rack::engine::PORT_MAX_CHANNELS>
+      engine_{signals_};
 };
 } // namespace booster_stage
 } // namespace envelope
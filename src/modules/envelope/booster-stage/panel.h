@@ -71,6 +71,11 @@ struct Panel : public PanelWidget<Panel> {
     InPort::install(this, InputId::Envelope, column1, y);
     OutPort::install(this, OutputId::Envelope, column5, y);
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    CurveLatchOption::install(menu, getModule(), ParamId::LatchCurve);
+    MicroDurationOption::install(menu, getModule(), ParamId::MicroDuration);
+  }
 };
 
 } // namespace booster_stage
@@ -2,74 +2,88 @@
 
 #include "control-ids.h"
 
-#include "components/cxmath.h"
 #include "components/sigmoid.h"
 #include "signals/basic.h"
 #include "signals/duration-signals.h"
 #include "signals/shape-signals.h"
 #include "signals/voltage-signals.h"
 
+#include <cmath>
 #include <vector>
 
 namespace dhe {
 namespace envelope {
 namespace booster_stage {
 
-template <typename TParam, typename TInput, typename TOutput> struct Signals {
-
-public:
+// Reads and writes the channels that start at a given channel, one per lane of
+// a SIMD vector T (such as rack::simd::float_4).
+template <typename T, typename TParam, typename TInput, typename TOutput>
+struct Signals {
   Signals(std::vector<TParam> const &params, std::vector<TInput> const &inputs,
           std::vector<TOutput> &outputs)
       : params_{params}, inputs_{inputs}, outputs_{outputs} {}
 
-  auto curvature() const -> float {
-    auto const rotation =
-        rotation_of(params_[ParamId::Curvature], inputs_[InputId::CurvatureCv]);
-    return Curvature::scale(Rotation::clamp(rotation));
+  auto curvature(int channel) const -> T {
+    using std::fmax;
+    using std::fmin;
+    auto const rotation = rotations_of<T>(
+        params_[ParamId::Curvature], inputs_[InputId::CurvatureCv], channel);
+    return Curvature::scale(fmin(fmax(rotation, T{0.F}), T{1.F}));
+  }
+
+  auto defer(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Defer], channel) |
+           button(ParamId::Defer);
   }
 
-  auto defer() const -> bool {
-    return is_high(inputs_[InputId::Defer]) ||
-           is_pressed(params_[ParamId::Defer]);
+  auto duration(int channel) const -> T {
+    using std::fmax;
+    auto const rotation = rotations_of<T>(
+        params_[ParamId::Duration], inputs_[InputId::DurationCv], channel);
+    auto const range_id =
+        is_pressed(params_[ParamId::MicroDuration])
+            ? DurationRangeId::Micro
+            : value_of<DurationRangeId>(params_[ParamId::DurationRange]);
+    return duration::scale(fmax(rotation, T{0.F}), Duration::range(range_id));
   }
 
-  auto duration() const -> float {
-    auto const rotation =
-        rotation_of(params_[ParamId::Duration], inputs_[InputId::DurationCv]);
-    auto const range =
-        value_of<DurationRangeId>(params_[ParamId::DurationRange]);
-    return Duration::scale(cx::max(rotation, 0.F), range);
+  auto gate(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Trigger], channel) |
+           button(ParamId::Trigger);
   }
 
-  auto gate() const -> bool {
-    return is_high(inputs_[InputId::Trigger]) ||
-           is_pressed(params_[ParamId::Trigger]);
+  auto input(int channel) const -> T {
+    return voltages_at<T>(inputs_[InputId::Envelope], channel);
   }
 
-  auto input() const -> float { return voltage_at(inputs_[InputId::Envelope]); }
+  auto latches_curve() const -> bool {
+    return is_pressed(params_[ParamId::LatchCurve]);
+  }
 
-  auto level() const -> float {
-    auto const rotation =
-        rotation_of(params_[ParamId::Level], inputs_[InputId::LevelCv]);
+  auto level(int channel) const -> T {
+    auto const rotation = rotations_of<T>(params_[ParamId::Level],
+                                          inputs_[InputId::LevelCv], channel);
     auto const range_id =
         value_of<VoltageRangeId>(params_[ParamId::LevelRange]);
-    return Voltage::scale(rotation, range_id);
+    return Voltage::range(range_id).scale(rotation);
+  }
+
+  auto trigger_voltage(int channel) const -> T {
+    return voltages_at<T>(inputs_[InputId::Trigger], channel);
   }
 
-  void output(float voltage) {
-    outputs_[OutputId::Envelope].setVoltage(voltage);
+  void output(int channel, T voltage) {
+    outputs_[OutputId::Envelope].setVoltageSimd(voltage, channel);
   }
 
-  void show_active(bool is_active) {
-    auto const voltage =
-        Voltage::scale(is_active || active_button(), VoltageRangeId::Unipolar);
-    outputs_[OutputId::Active].setVoltage(voltage);
+  void show_active(int channel, T active) {
+    auto const shown = active | button(ParamId::Active);
+    outputs_[OutputId::Active].setVoltageSimd(gate_voltages(shown), channel);
   }
 
-  void show_eoc(bool is_eoc) {
-    auto const voltage =
-        Voltage::scale(is_eoc || active_button(), VoltageRangeId::Unipolar);
-    outputs_[OutputId::Eoc].setVoltage(voltage);
+  void show_eoc(int channel, T eoc) {
+    auto const shown = eoc | button(ParamId::Eoc);
+    outputs_[OutputId::Eoc].setVoltageSimd(gate_voltages(shown), channel);
   }
 
   auto shape() const -> Shape::Id {
@@ -77,12 +91,10 @@ public:
   }
 
 private:
-  auto active_button() const -> bool {
-    return is_pressed(params_[ParamId::Active]);
+  auto button(int param_id) const -> T {
+    return lane_mask<T>(is_pressed(params_[param_id]));
   }
 
-  auto eoc_button() const -> bool { return is_pressed(params_[ParamId::Eoc]); }
-
   std::vector<TParam> const &params_;
   std::vector<TInput> const &inputs_;
   std::vector<TOutput> &outputs_;
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace dhe {
+namespace envelope {
+// The duration of the pulse that an envelope stage sends at the end of each
+// cycle.
+static auto constexpr eoc_duration = 1e-3F;
+} // namespace envelope
+} // namespace dhe
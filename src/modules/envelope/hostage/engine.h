@@ -4,6 +4,9 @@
 
 #include "components/latch.h"
 #include "components/phase-timer.h"
+#include "components/sample-rate.h"
+#include "components/state-machine.h"
+#include "modules/envelope/eoc.h"
 #include "modules/envelope/mode/events.h"
 #include "modules/envelope/mode/mode-ids.h"
 
@@ -12,6 +15,13 @@
 namespace dhe {
 namespace envelope {
 namespace hostage {
+/**
+ * Runs a single Hostage channel, dispatching its modes through a StateMachine.
+ * Stage Chain runs its hostage slots on this engine. The polyphonic modules
+ * run hostage::PolyEngine instead, whose lanes may each be in a different
+ * mode, so it selects each lane's output by mode mask rather than dispatching
+ * on one mode.
+ */
 template <typename Signals, typename InputMode, typename DeferMode,
           typename HoldMode, typename SustainMode, typename IdleMode>
 struct Engine {
@@ -21,46 +31,48 @@ struct Engine {
         hold_mode_{hold_mode}, sustain_mode_{sustain_mode}, idle_mode_{
                                                                 idle_mode} {}
 
+  // Precomputes the EOC pulse's phase increment per sample.
+  void on_sample_rate_change(float sample_time) {
+    eoc_delta_per_sample_ = sample_time / eoc_duration;
+  }
+
   void process(float sample_time) {
+    if (is_asleep_ && !wakes()) {
+      signals_.show_eoc(false);
+      return;
+    }
+
     defer_.clock(signals_.defer());
     gate_.clock(signals_.gate() && !defer_.is_high());
 
     auto const new_mode_id = identify_mode();
-    if (mode_id_ != new_mode_id) {
-      enter(new_mode_id);
+    if (modes_.id() != new_mode_id) {
+      modes_.enter(*this, new_mode_id);
     }
 
-    switch (mode_id_) {
-    case envelope::ModeId::Defer:
-      defer_mode_.execute();
-      break;
-    case envelope::ModeId::Hold:
-      if (hold_mode_.execute(gate_, sample_time) == Event::Completed) {
-        eoc_timer_.reset();
-        enter(envelope::ModeId::Idle);
-      }
-      break;
-    case envelope::ModeId::Idle:
-      idle_mode_.execute();
-      break;
-    case envelope::ModeId::Sustain:
-      if (sustain_mode_.execute(gate_) == Event::Completed) {
-        eoc_timer_.reset();
-        enter(envelope::ModeId::Idle);
-      }
-      break;
-    case envelope::ModeId::Input:
-      input_mode_.execute();
-      break;
-    default:
-      break;
-    }
+    modes_.execute(*this, sample_time);
 
-    eoc_timer_.advance(sample_time / 1e-3F);
+    eoc_timer_.advance(eoc_delta_per_sample_);
     signals_.show_eoc(eoc_timer_.in_progress());
+    is_asleep_ = can_sleep();
   }
 
 private:
+  // The engine sleeps while it rests in idle mode with no EOC pulse in
+  // progress. Until the defer or gate signal changes, the full process would
+  // only clock the latches to the same states and advance an expired timer.
+  // Idle mode leaves the output at the voltage the stage ended with, so a
+  // sleeping engine writes nothing but the EOC signal. Input mode does not
+  // sleep, because its output follows the input.
+  auto can_sleep() const -> bool {
+    return modes_.id() == envelope::ModeId::Idle && !defer_.is_edge() &&
+           !gate_.is_edge() && !eoc_timer_.in_progress();
+  }
+
+  auto wakes() const -> bool {
+    return signals_.defer() || signals_.gate() != gate_.is_high();
+  }
+
   auto identify_mode() -> envelope::ModeId {
     if (defer_.is_high()) {
       return envelope::ModeId::Defer;
@@ -75,57 +87,63 @@ private:
       }
       return envelope::ModeId::Input;
     }
-    return mode_id_;
+    return modes_.id();
+  }
+
+  template <envelope::ModeId I> using Mode = State<envelope::ModeId, I>;
+  using Modes =
+      StateMachine<Engine, envelope::ModeId, envelope::ModeId::Defer,
+                   envelope::ModeId::Hold, envelope::ModeId::Idle,
+                   envelope::ModeId::Input, envelope::ModeId::Sustain>;
+  friend Modes;
+
+  void enter(Mode<envelope::ModeId::Defer> /*mode*/) { defer_mode_.enter(); }
+  void exit(Mode<envelope::ModeId::Defer> /*mode*/) { defer_mode_.exit(); }
+  void execute(Mode<envelope::ModeId::Defer> /*mode*/,
+               float /*sample_time*/) {
+    defer_mode_.execute();
   }
 
-  void enter(envelope::ModeId new_mode_id) {
-    switch (mode_id_) {
-    case envelope::ModeId::Defer:
-      defer_mode_.exit();
-      break;
-    case envelope::ModeId::Hold:
-      hold_mode_.exit();
-      break;
-    case envelope::ModeId::Idle:
-      idle_mode_.exit();
-      break;
-    case envelope::ModeId::Input:
-      input_mode_.exit();
-      break;
-    case envelope::ModeId::Sustain:
-      sustain_mode_.exit();
-      break;
-    default:
-      break;
+  void enter(Mode<envelope::ModeId::Hold> /*mode*/) { hold_mode_.enter(); }
+  void exit(Mode<envelope::ModeId::Hold> /*mode*/) { hold_mode_.exit(); }
+  void execute(Mode<envelope::ModeId::Hold> /*mode*/, float sample_time) {
+    if (hold_mode_.execute(gate_, sample_time) == Event::Completed) {
+      eoc_timer_.reset();
+      modes_.enter(*this, envelope::ModeId::Idle);
     }
+  }
 
-    mode_id_ = new_mode_id;
-
-    switch (mode_id_) {
-    case envelope::ModeId::Defer:
-      defer_mode_.enter();
-      break;
-    case envelope::ModeId::Hold:
-      hold_mode_.enter();
-      break;
-    case envelope::ModeId::Idle:
-      idle_mode_.enter();
-      break;
-    case envelope::ModeId::Sustain:
-      sustain_mode_.enter();
-      break;
-    case envelope::ModeId::Input:
-      input_mode_.enter();
-      break;
-    default:
-      break;
+  void enter(Mode<envelope::ModeId::Idle> /*mode*/) { idle_mode_.enter(); }
+  void exit(Mode<envelope::ModeId::Idle> /*mode*/) { idle_mode_.exit(); }
+  void execute(Mode<envelope::ModeId::Idle> /*mode*/, float /*sample_time*/) {
+    idle_mode_.execute();
+  }
+
+  void enter(Mode<envelope::ModeId::Input> /*mode*/) { input_mode_.enter(); }
+  void exit(Mode<envelope::ModeId::Input> /*mode*/) { input_mode_.exit(); }
+  void execute(Mode<envelope::ModeId::Input> /*mode*/,
+               float /*sample_time*/) {
+    input_mode_.execute();
+  }
+
+  void enter(Mode<envelope::ModeId::Sustain> /*mode*/) {
+    sustain_mode_.enter();
+  }
+  void exit(Mode<envelope::ModeId::Sustain> /*mode*/) { sustain_mode_.exit(); }
+  void execute(Mode<envelope::ModeId::Sustain> /*mode*/,
+               float /*sample_time*/) {
+    if (sustain_mode_.execute(gate_) == Event::Completed) {
+      eoc_timer_.reset();
+      modes_.enter(*this, envelope::ModeId::Idle);
     }
   }
 
-  envelope::ModeId mode_id_{envelope::ModeId::Input};
   PhaseTimer eoc_timer_{1.F};
+  float eoc_delta_per_sample_{default_sample_time / eoc_duration};
   Latch defer_{};
   Latch gate_{};
+  bool is_asleep_{false};
+  Modes modes_{envelope::ModeId::Input};
   Signals &signals_;
   InputMode &input_mode_;
   DeferMode &defer_mode_;
@@ -2,17 +2,12 @@
 
 #include "control-ids.h"
 #include "controls.h"
-#include "engine.h"
 #include "mode-ids.h"
+#include "poly-engine.h"
 #include "signals.h"
 
 #include "controls/duration-controls.h"
 #include "controls/knobs.h"
-#include "modules/envelope/mode/defer-mode.h"
-#include "modules/envelope/mode/hold-mode.h"
-#include "modules/envelope/mode/idle-mode.h"
-#include "modules/envelope/mode/input-mode.h"
-#include "modules/envelope/mode/sustain-mode.h"
 #include "params/presets.h"
 #include "signals/duration-signals.h"
 
@@ -44,7 +39,15 @@ struct Module : public rack::engine::Module {
   };
 
   void process(ProcessArgs const &args) override {
-    engine_.process(args.sampleTime);
+    auto const channels = channel_count(inputs);
+    for (auto &output : outputs) {
+      output.setChannels(channels);
+    }
+    engine_.process(channels, args.sampleTime);
+  }
+
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    engine_.on_sample_rate_change(e.sampleTime);
   }
 
   auto dataToJson() -> json_t * override {
@@ -54,25 +57,13 @@ struct Module : public rack::engine::Module {
   }
 
 private:
-  using RackSignals =
-      Signals<rack::engine::Param, rack::engine::Input, rack::engine::Output>;
-  using DeferM = envelope::DeferMode<RackSignals>;
-  using HoldM = envelope::HoldMode<RackSignals, PhaseTimer>;
-  using IdleM = envelope::IdleMode<RackSignals>;
-  using InputM = envelope::InputMode<RackSignals>;
-  using SustainM = envelope::SustainMode<RackSignals>;
-  using RackEngine =
-      Engine<RackSignals, InputM, DeferM, HoldM, SustainM, IdleM>;
+  using float_4 = rack::simd::float_4;
+  using RackSignals = Signals<float_4, rack::engine::Param,
+                              rack::engine::Input, rack::engine::Output>;
 
-  RackSignals controls_{params, inputs, outputs};
-  DeferM defer_mode_{controls_};
-  PhaseTimer hold_timer_{};
-  HoldM hold_mode_{controls_, hold_timer_};
-  IdleM idle_mode_{controls_};
-  SustainM sustain_mode_{controls_};
-  InputM input_mode_{controls_};
-  RackEngine engine_{controls_,  input_mode_,   defer_mode_,
-                     hold_mode_, sustain_mode_, idle_mode_};
+  RackSignals signals_{params, inputs, outputs};
+  PolyEngine<float_4, RackSignals, rack::engine::PORT_MAX_CHANNELS> engine_{
+      signals_};
 };
 } // namespace hostage
 } // namespace envelope
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "components/sample-rate.h"
+#include "modules/envelope/eoc.h"
+#include "modules/envelope/mode/mode-ids.h"
+#include "signals/basic.h"
+
+#include <array>
+#include <cmath>
+
+namespace dhe {
+namespace envelope {
+namespace hostage {
+
+/**
+ * Runs a Hostage engine on each channel of a polyphonic module. The state of
+ * each channel occupies a lane of a SIMD vector T (such as
+ * rack::simd::float_4), so that each step of the engine processes T::size
+ * channels at once. Instead of switching on each channel's mode, the engine
+ * keeps a lane mask per mode, computes each mode's output for every lane, and
+ * selects each lane's output by its mode's mask.
+ *
+ * A vector of channels sleeps while each of its channels rests in defer,
+ * input, or idle mode with no EOC pulse in progress. Until a channel's gate,
+ * defer signal, or output changes, the full process would only repeat the
+ * same outputs, so a sleeping vector sends the outputs it stored when it fell
+ * asleep.
+ */
+template <typename T, typename Signals, int N> class PolyEngine {
+public:
+  PolyEngine(Signals &signals) : signals_{signals} {}
+
+  // Precomputes the EOC pulse's phase increment per sample.
+  void on_sample_rate_change(float sample_time) {
+    eoc_delta_per_sample_ = sample_time / eoc_duration;
+  }
+
+  auto is_asleep(int channel) const -> bool {
+    return lanes_[channel / T::size].asleep_;
+  }
+
+  void process(int channels, float sample_time) {
+    for (auto channel = 0; channel < channels; channel += T::size) {
+      process(lanes_[channel / T::size], channel, sample_time);
+    }
+  }
+
+private:
+  // The state of the channels in one SIMD vector. Each mode mask sets the
+  // lanes in that mode. A lane in no mode is in defer mode if its defer signal
+  // is high, and otherwise in input mode.
+  struct Lanes {
+    T defer_{0.F};
+    T gate_{0.F};
+    T holding_{0.F};
+    T sustaining_{0.F};
+    T idling_{0.F};
+    T phase_{0.F};
+    T output_{0.F};
+    T eoc_phase_{1.F};
+    bool asleep_{false};
+  };
+
+  void process(Lanes &lanes, int channel, float sample_time) {
+    using std::fmin;
+
+    if (lanes.asleep_ && stays_asleep(lanes, channel)) {
+      signals_.output(channel, lanes.output_);
+      signals_.show_active(channel, lanes.defer_);
+      signals_.show_eoc(channel, T{0.F});
+      return;
+    }
+
+    auto const defer = signals_.defer(channel);
+    auto const gate = signals_.gate(channel) & ~defer;
+    auto const rise = gate & ~lanes.gate_;
+    auto const defer_fall = lanes.defer_ & ~defer;
+    auto const sustains =
+        lane_mask<T>(signals_.mode() == envelope::ModeId::Sustain);
+
+    // A rising gate starts a hold or a sustain. When defer falls, a lane
+    // idles and ends its stage if the module is in sustain mode, and otherwise
+    // returns to input mode. Defer overrides every mode.
+    auto const idles = defer_fall & ~rise & sustains;
+    lanes.holding_ = ifelse(rise, ~sustains, lanes.holding_ & ~defer);
+    lanes.sustaining_ = ifelse(rise, sustains, lanes.sustaining_ & ~defer);
+    lanes.idling_ = (lanes.idling_ & ~(rise | defer)) | idles;
+    auto ends = idles;
+
+    // A lane in defer or input mode sends its input. A hold holds the input
+    // it took when it started.
+    auto const starts_hold = rise & lanes.holding_;
+    auto const sends_input =
+        ~(lanes.holding_ | lanes.sustaining_ | lanes.idling_) | starts_hold;
+    lanes.output_ = ifelse(sends_input, signals_.input(channel), lanes.output_);
+
+    if (movemask(lanes.holding_) != 0) {
+      auto const phase = ifelse(starts_hold, T{0.F}, lanes.phase_) +
+                         sample_time / signals_.duration(channel);
+      lanes.phase_ = ifelse(lanes.holding_, fmin(phase, T{1.F}), lanes.phase_);
+      ends = ends | (lanes.holding_ & (phase >= T{1.F}));
+    }
+    ends = ends | (lanes.sustaining_ & ~gate);
+
+    lanes.idling_ = lanes.idling_ | ends;
+    lanes.holding_ = lanes.holding_ & ~ends;
+    lanes.sustaining_ = lanes.sustaining_ & ~ends;
+
+    auto const eoc_phase = ifelse(ends, T{0.F}, lanes.eoc_phase_);
+    lanes.eoc_phase_ = fmin(eoc_phase + eoc_delta_per_sample_, T{1.F});
+    lanes.defer_ = defer;
+    lanes.gate_ = gate;
+
+    signals_.output(channel, lanes.output_);
+    signals_.show_active(channel, defer | lanes.holding_ | lanes.sustaining_);
+    signals_.show_eoc(channel, lanes.eoc_phase_ < T{1.F});
+
+    auto const busy =
+        lanes.holding_ | lanes.sustaining_ | (lanes.eoc_phase_ < T{1.F});
+    lanes.asleep_ = movemask(busy) == 0;
+  }
+
+  // Whether a sleeping vector stays asleep: no channel's defer signal or gate
+  // has changed, and no channel that sends its input has a new input. An idle
+  // channel's output does not change.
+  auto stays_asleep(Lanes const &lanes, int channel) const -> bool {
+    auto const defer = signals_.defer(channel);
+    auto const gate = signals_.gate(channel) & ~defer;
+    if (movemask((defer ^ lanes.defer_) | (gate ^ lanes.gate_)) != 0) {
+      return false;
+    }
+    auto const sends_input = ~lanes.idling_;
+    if (movemask(sends_input) == 0) {
+      return true;
+    }
+    auto const input = signals_.input(channel);
+    return movemask(sends_input & (input != lanes.output_)) == 0;
+  }
+
+  Signals &signals_;
+  float eoc_delta_per_sample_{default_sample_time / eoc_duration};
+  std::array<Lanes, N / T::size> lanes_{};
+};
+} // namespace hostage
+} // namespace envelope
+} // namespace dhe
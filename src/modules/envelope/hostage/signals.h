@@ -5,7 +5,6 @@
 #include "modules/envelope/mode/mode-ids.h"
 #include "signals/basic.h"
 #include "signals/duration-signals.h"
-#include "signals/voltage-signals.h"
 
 #include <vector>
 
@@ -13,42 +12,49 @@ namespace dhe {
 namespace envelope {
 namespace hostage {
 
-template <typename TParam, typename TInput, typename TOutput> struct Signals {
+// Reads and writes the channels that start at a given channel, one per lane of
+// a SIMD vector T (such as rack::simd::float_4).
+template <typename T, typename TParam, typename TInput, typename TOutput>
+struct Signals {
   Signals(std::vector<TParam> const &params, std::vector<TInput> const &inputs,
           std::vector<TOutput> &outputs)
       : params_{params}, inputs_{inputs}, outputs_{outputs} {};
 
-  auto defer() const -> bool { return is_high(inputs_[InputId::Defer]); }
+  auto defer(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Defer], channel);
+  }
 
-  auto duration() const -> float {
-    auto const rotation =
-        rotation_of(params_[ParamId::Duration], inputs_[InputId::DurationCv]);
-    auto const range =
+  auto duration(int channel) const -> T {
+    auto const rotation = rotations_of<T>(
+        params_[ParamId::Duration], inputs_[InputId::DurationCv], channel);
+    auto const range_id =
         value_of<DurationRangeId>(params_[ParamId::DurationRange]);
-    return Duration::scale(rotation, range);
+    return duration::scale(rotation, Duration::range(range_id));
   }
 
-  auto gate() const -> bool { return is_high(inputs_[InputId::Trigger]); }
+  auto gate(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Trigger], channel);
+  }
 
-  auto input() const -> float { return voltage_at(inputs_[InputId::Envelope]); }
+  auto input(int channel) const -> T {
+    return voltages_at<T>(inputs_[InputId::Envelope], channel);
+  }
 
   auto mode() const -> envelope::ModeId {
     return is_pressed(params_[ParamId::Mode]) ? envelope::ModeId::Sustain
                                               : envelope::ModeId::Hold;
   }
 
-  void output(float voltage) {
-    outputs_[OutputId::Envelope].setVoltage(voltage);
+  void output(int channel, T voltage) {
+    outputs_[OutputId::Envelope].setVoltageSimd(voltage, channel);
   }
 
-  void show_active(bool active) {
-    auto const voltage = UnipolarVoltage::scale(static_cast<float>(active));
-    outputs_[OutputId::Active].setVoltage(voltage);
+  void show_active(int channel, T active) {
+    outputs_[OutputId::Active].setVoltageSimd(gate_voltages(active), channel);
   }
 
-  void show_eoc(bool eoc) {
-    auto const voltage = UnipolarVoltage::scale(static_cast<float>(eoc));
-    outputs_[OutputId::Eoc].setVoltage(voltage);
+  void show_eoc(int channel, T eoc) {
+    outputs_[OutputId::Eoc].setVoltageSimd(gate_voltages(eoc), channel);
   }
 
 private:
@@ -3,6 +3,8 @@
 #include "booster-stage/panel.h"
 #include "hostage/module.h"
 #include "hostage/panel.h"
+#include "stage-chain/module.h"
+#include "stage-chain/panel.h"
 #include "stage/module.h"
 #include "stage/panel.h"
 #include "upstage/module.h"
@@ -19,6 +21,9 @@ void init(rack::plugin::Plugin *plugin) {
   plugin->addModel(
       rack::createModel<hostage::Module, hostage::Panel>("Hostage"));
   plugin->addModel(rack::createModel<stage::Module, stage::Panel>("Stage"));
+  plugin->addModel(
+      rack::createModel<stage_chain::Module, stage_chain::Panel>(
+          "StageChain"));
   plugin->addModel(
       rack::createModel<upstage::Module, upstage::Panel>("Upstage"));
 }
@@ -17,15 +17,21 @@ public:
   auto execute(Latch const &retrigger, float sample_time) -> Event {
     if (retrigger.is_rise()) {
       initialize_curve();
+      // Advance only through the portion of the sample that followed the edge.
+      sample_time *= retrigger.edge_fraction();
+    }
+    if (!latched_) {
+      read_curve();
     }
-    auto const level = signals_.level();
-    auto const curvature = signals_.curvature();
-    auto const shape = signals_.shape();
 
-    timer_.advance(sample_time / signals_.duration());
-    auto const tapered_phase = Shape::apply(timer_.phase(), shape, curvature);
+    auto const phase_delta =
+        latched_ ? sample_time * phase_per_second_ : sample_time / duration_;
+    auto const excess_phase = timer_.phase() + phase_delta - 1.F;
+    leftover_time_ = cx::max(excess_phase, 0.F) * duration_;
+    timer_.advance(phase_delta);
+    auto const tapered_phase = Shape::apply(timer_.phase(), shape_, curvature_);
 
-    signals_.output(cx::scale(tapered_phase, start_voltage_, level));
+    signals_.output(cx::scale(tapered_phase, start_voltage_, level_));
 
     return timer_.in_progress() ? Event::Generated : Event::Completed;
   }
@@ -37,13 +43,36 @@ public:
 
   void exit() { signals_.show_active(false); }
 
+  // The portion of the most recently generated sample that remained after the
+  // curve completed.
+  auto leftover_time() const -> float { return leftover_time_; }
+
 private:
   void initialize_curve() {
     start_voltage_ = signals_.input();
     timer_.reset();
+    latched_ = signals_.latches_curve();
+    read_curve();
+    phase_per_second_ = 1.F / duration_;
+  }
+
+  void read_curve() {
+    level_ = signals_.level();
+    curvature_ = signals_.curvature();
+    shape_ = signals_.shape();
+    duration_ = signals_.duration();
   }
 
   float start_voltage_{0.F};
+  // When latched, the curve read at the start of the stage holds until the
+  // stage ends, so execute() skips reading the controls.
+  bool latched_{false};
+  float level_{0.F};
+  float curvature_{0.F};
+  Shape::Id shape_{Shape::Id::J};
+  float duration_{1.F};
+  float phase_per_second_{1.F};
+  float leftover_time_{0.F};
   Signals &signals_;
   Timer &timer_;
 };
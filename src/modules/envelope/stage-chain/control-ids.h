@@ -0,0 +1,33 @@
+#pragma once
+
+namespace dhe {
+namespace envelope {
+namespace stage_chain {
+struct ParamId {
+  enum {
+    AttackLevel,
+    AttackCurvature,
+    AttackDuration,
+    DecayLevel,
+    DecayCurvature,
+    DecayDuration,
+    HostageMode,
+    HostageDuration,
+    ReleaseLevel,
+    ReleaseCurvature,
+    ReleaseDuration,
+    LatchCurve,
+    Count
+  };
+};
+
+struct InputId {
+  enum { Defer, Envelope, Gate, Count };
+};
+
+struct OutputId {
+  enum { Active, Envelope, Eoc, Count };
+};
+} // namespace stage_chain
+} // namespace envelope
+} // namespace dhe
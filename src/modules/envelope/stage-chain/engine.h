@@ -0,0 +1,164 @@
+#pragma once
+
+#include "control-ids.h"
+#include "signals.h"
+
+#include "components/latch.h"
+#include "components/phase-timer.h"
+#include "modules/envelope/hostage/engine.h"
+#include "modules/envelope/mode/defer-mode.h"
+#include "modules/envelope/mode/generate-mode.h"
+#include "modules/envelope/mode/hold-mode.h"
+#include "modules/envelope/mode/idle-mode.h"
+#include "modules/envelope/mode/input-mode.h"
+#include "modules/envelope/mode/level-mode.h"
+#include "modules/envelope/mode/sustain-mode.h"
+#include "modules/envelope/stage/engine.h"
+#include "signals/basic.h"
+#include "signals/voltage-signals.h"
+
+#include <vector>
+
+namespace dhe {
+namespace envelope {
+namespace stage_chain {
+
+// A Stage engine and the modes and signals it operates on.
+template <typename TParam> class StageSlot {
+public:
+  StageSlot(std::vector<TParam> const &params, int first_param,
+            Link const &upstream, Trigger const &trigger, Link &link)
+      : signals_{params, first_param, upstream, trigger, link} {}
+
+  void process(float sample_time) { engine_.process(sample_time); }
+
+  void on_sample_rate_change(float sample_time) {
+    engine_.on_sample_rate_change(sample_time);
+  }
+
+private:
+  using Signals = StageSignals<TParam>;
+  using DeferM = DeferMode<Signals>;
+  using GenerateM = GenerateMode<Signals, PhaseTimer>;
+  using InputM = InputMode<Signals>;
+  using LevelM = LevelMode<Signals>;
+  using StageEngine = stage::Engine<Signals, DeferM, InputM, GenerateM, LevelM>;
+
+  Signals signals_;
+  PhaseTimer timer_{};
+  DeferM defer_mode_{signals_};
+  InputM input_mode_{signals_};
+  GenerateM generate_mode_{signals_, timer_};
+  LevelM level_mode_{signals_};
+  StageEngine engine_{signals_, defer_mode_, input_mode_, generate_mode_,
+                      level_mode_};
+};
+
+// A Hostage engine and the modes and signals it operates on.
+template <typename TParam> class HostageSlot {
+public:
+  HostageSlot(std::vector<TParam> const &params, Link const &upstream,
+              Trigger const &trigger, Link &link)
+      : signals_{params, upstream, trigger, link} {}
+
+  void process(float sample_time) { engine_.process(sample_time); }
+
+  void on_sample_rate_change(float sample_time) {
+    engine_.on_sample_rate_change(sample_time);
+  }
+
+  auto mode() const -> envelope::ModeId { return signals_.mode(); }
+
+private:
+  using Signals = HostageSignals<TParam>;
+  using DeferM = DeferMode<Signals>;
+  using HoldM = HoldMode<Signals, PhaseTimer>;
+  using IdleM = IdleMode<Signals>;
+  using InputM = InputMode<Signals>;
+  using SustainM = SustainMode<Signals>;
+  using HostageEngine =
+      hostage::Engine<Signals, InputM, DeferM, HoldM, SustainM, IdleM>;
+
+  Signals signals_;
+  PhaseTimer timer_{};
+  DeferM defer_mode_{signals_};
+  HoldM hold_mode_{signals_, timer_};
+  IdleM idle_mode_{signals_};
+  InputM input_mode_{signals_};
+  SustainM sustain_mode_{signals_};
+  HostageEngine engine_{signals_,    input_mode_,   defer_mode_,
+                        hold_mode_,  sustain_mode_, idle_mode_};
+};
+
+/**
+ * Runs attack, decay, hold/sustain, and release stages as a chain, each
+ * deferring to the one before it. The stages run in upstream order within each
+ * sample, so each stage sees its upstream stage's outputs from the same sample
+ * instead of from the sample before.
+ */
+template <typename TParam, typename TInput, typename TOutput> class Engine {
+public:
+  Engine(std::vector<TParam> const &params, std::vector<TInput> const &inputs,
+         std::vector<TOutput> &outputs)
+      : inputs_{inputs}, outputs_{outputs},
+        attack_{params, ParamId::AttackLevel, head_, gate_, attack_link_},
+        decay_{params, ParamId::DecayLevel, attack_link_, attack_link_.eoc_,
+               decay_link_},
+        hostage_{params, decay_link_, hostage_trigger_, hostage_link_},
+        release_{params, ParamId::ReleaseLevel, hostage_link_,
+                 hostage_link_.eoc_, release_link_} {}
+
+  void on_sample_rate_change(float sample_time) {
+    attack_.on_sample_rate_change(sample_time);
+    decay_.on_sample_rate_change(sample_time);
+    hostage_.on_sample_rate_change(sample_time);
+    release_.on_sample_rate_change(sample_time);
+  }
+
+  void process(float sample_time) {
+    auto const gate_voltage = voltage_at(inputs_[InputId::Gate]);
+    gate_ = Trigger{gate_voltage > high_threshold,
+                    latch::edge_fraction(gate_voltage_, gate_voltage,
+                                         high_threshold)};
+    gate_voltage_ = gate_voltage;
+    head_.active_ = is_high(inputs_[InputId::Defer]);
+    head_.output_ = voltage_at(inputs_[InputId::Envelope]);
+
+    attack_.process(sample_time);
+    decay_.process(sample_time);
+    // A sustain stage sustains while the gate is high. A hold stage holds for
+    // its duration when the decay stage ends.
+    hostage_trigger_ =
+        hostage_.mode() == envelope::ModeId::Sustain ? gate_ : decay_link_.eoc_;
+    hostage_.process(sample_time);
+    release_.process(sample_time);
+
+    outputs_[OutputId::Envelope].setVoltage(release_link_.output_);
+    show(OutputId::Active, release_link_.active_);
+    show(OutputId::Eoc, release_link_.eoc_.is_high_);
+  }
+
+private:
+  void show(int output_id, bool state) {
+    auto const voltage = UnipolarVoltage::scale(static_cast<float>(state));
+    outputs_[output_id].setVoltage(voltage);
+  }
+
+  std::vector<TInput> const &inputs_;
+  std::vector<TOutput> &outputs_;
+  float gate_voltage_{};
+  Trigger gate_{};
+  Trigger hostage_trigger_{};
+  Link head_{};
+  Link attack_link_{};
+  Link decay_link_{};
+  Link hostage_link_{};
+  Link release_link_{};
+  StageSlot<TParam> attack_;
+  StageSlot<TParam> decay_;
+  HostageSlot<TParam> hostage_;
+  StageSlot<TParam> release_;
+};
+} // namespace stage_chain
+} // namespace envelope
+} // namespace dhe
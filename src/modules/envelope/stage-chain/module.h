@@ -0,0 +1,71 @@
+#pragma once
+
+#include "control-ids.h"
+#include "engine.h"
+
+#include "controls/duration-controls.h"
+#include "controls/knobs.h"
+#include "controls/shape-controls.h"
+#include "controls/voltage-controls.h"
+#include "modules/envelope/hostage/controls.h"
+#include "params/presets.h"
+
+#include "rack.hpp"
+
+namespace dhe {
+namespace envelope {
+namespace stage_chain {
+struct Module : public rack::engine::Module {
+  Module() {
+    config(ParamId::Count, InputId::Count, OutputId::Count);
+
+    UnipolarKnob::config(this, ParamId::AttackLevel, "Attack level", 10.F);
+    CurvatureKnob::config(this, ParamId::AttackCurvature, "Attack curvature");
+    MediumDurationKnob::config(this, ParamId::AttackDuration,
+                               "Attack duration", 0.1F);
+
+    UnipolarKnob::config(this, ParamId::DecayLevel, "Decay level");
+    CurvatureKnob::config(this, ParamId::DecayCurvature, "Decay curvature");
+    MediumDurationKnob::config(this, ParamId::DecayDuration, "Decay duration",
+                               0.3F);
+
+    hostage::ModeSwitch::config(this, ParamId::HostageMode, "Hostage mode");
+    MediumDurationKnob::config(this, ParamId::HostageDuration,
+                               "Hold duration", 0.5F);
+
+    UnipolarKnob::config(this, ParamId::ReleaseLevel, "Release level", 0.F);
+    CurvatureKnob::config(this, ParamId::ReleaseCurvature,
+                          "Release curvature");
+    MediumDurationKnob::config(this, ParamId::ReleaseDuration,
+                               "Release duration");
+    CurveLatchOption::config(this, ParamId::LatchCurve);
+
+    configInput(InputId::Envelope, "Stage");
+    configInput(InputId::Defer, "Defer");
+    configInput(InputId::Gate, "Gate");
+    configOutput(OutputId::Active, "Is active");
+    configOutput(OutputId::Eoc, "End of envelope");
+    configOutput(OutputId::Envelope, "Envelope");
+  }
+
+  void process(ProcessArgs const &args) override {
+    engine_.process(args.sampleTime);
+  }
+
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    engine_.on_sample_rate_change(e.sampleTime);
+  }
+
+  auto dataToJson() -> json_t * override {
+    auto *data = json_object();
+    json_object_set_new(data, preset_version_key, json_integer(0));
+    return data;
+  }
+
+private:
+  Engine<rack::engine::Param, rack::engine::Input, rack::engine::Output>
+      engine_{params, inputs, outputs};
+};
+} // namespace stage_chain
+} // namespace envelope
+} // namespace dhe
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "control-ids.h"
+
+#include "controls/knobs.h"
+#include "controls/ports.h"
+#include "controls/shape-controls.h"
+#include "modules/envelope/hostage/controls.h"
+#include "panels/panel-widget.h"
+
+#include "rack.hpp"
+
+namespace dhe {
+namespace envelope {
+namespace stage_chain {
+
+struct Panel : public PanelWidget<Panel> {
+  static auto constexpr hp = 10;
+  static auto constexpr panel_file = "stage-chain";
+  static auto constexpr svg_dir = "stage-chain";
+
+  explicit Panel(rack::engine::Module *module) : PanelWidget<Panel>{module} {
+    auto constexpr width = hp2mm(hp);
+
+    auto constexpr attack_x = width / 8.F;
+    auto constexpr decay_x = attack_x + width / 4.F;
+    auto constexpr hostage_x = decay_x + width / 4.F;
+    auto constexpr release_x = hostage_x + width / 4.F;
+
+    auto constexpr level_y = 30.F;
+    auto constexpr curvature_y = 47.F;
+    auto constexpr duration_y = 64.F;
+
+    Knob::install<Small>(this, ParamId::AttackLevel, attack_x, level_y);
+    Knob::install<Small>(this, ParamId::AttackCurvature, attack_x,
+                         curvature_y);
+    Knob::install<Small>(this, ParamId::AttackDuration, attack_x, duration_y);
+
+    Knob::install<Small>(this, ParamId::DecayLevel, decay_x, level_y);
+    Knob::install<Small>(this, ParamId::DecayCurvature, decay_x, curvature_y);
+    Knob::install<Small>(this, ParamId::DecayDuration, decay_x, duration_y);
+
+    hostage::ModeSwitch::install(this, ParamId::HostageMode, hostage_x,
+                                 curvature_y);
+    Knob::install<Small>(this, ParamId::HostageDuration, hostage_x,
+                         duration_y);
+
+    Knob::install<Small>(this, ParamId::ReleaseLevel, release_x, level_y);
+    Knob::install<Small>(this, ParamId::ReleaseCurvature, release_x,
+                         curvature_y);
+    Knob::install<Small>(this, ParamId::ReleaseDuration, release_x,
+                         duration_y);
+
+    auto constexpr left = width / 4.F + 0.333333F;
+    auto constexpr right = width - left;
+
+    auto y = 82.F;
+    auto constexpr dy = 15.F;
+
+    InPort::install(this, InputId::Defer, left, y);
+    OutPort::install(this, OutputId::Active, right, y);
+
+    y += dy;
+    InPort::install(this, InputId::Gate, left, y);
+    OutPort::install(this, OutputId::Eoc, right, y);
+
+    y += dy;
+    InPort::install(this, InputId::Envelope, left, y);
+    OutPort::install(this, OutputId::Envelope, right, y);
+  }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    CurveLatchOption::install(menu, getModule(), ParamId::LatchCurve);
+  }
+};
+} // namespace stage_chain
+} // namespace envelope
+} // namespace dhe
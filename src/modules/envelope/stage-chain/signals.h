@@ -0,0 +1,127 @@
+#pragma once
+
+#include "control-ids.h"
+
+#include "components/sigmoid.h"
+#include "modules/envelope/mode/mode-ids.h"
+#include "signals/basic.h"
+#include "signals/duration-signals.h"
+#include "signals/shape-signals.h"
+#include "signals/voltage-signals.h"
+
+#include <vector>
+
+namespace dhe {
+namespace envelope {
+namespace stage_chain {
+
+// A signal that triggers a stage.
+struct Trigger {
+  bool is_high_;        // NOLINT
+  float edge_fraction_; // NOLINT
+};
+
+// The outputs of one stage in the chain, which are the inputs of the next.
+struct Link {
+  // Shows an EOC that changes state at the start of the sample.
+  void show_eoc(bool eoc) { show_eoc(eoc, 1.F); }
+
+  // Shows an EOC that changes state partway through the sample, leaving the
+  // given portion of the sample for the next stage.
+  void show_eoc(bool eoc, float edge_fraction) {
+    eoc_ = Trigger{eoc, edge_fraction};
+  }
+
+  float output_{}; // NOLINT
+  bool active_{};  // NOLINT
+  Trigger eoc_{};  // NOLINT
+};
+
+// Signals for a stage whose level, curvature, and duration params are
+// consecutive, starting at first_param.
+template <typename TParam> class StageSignals {
+public:
+  StageSignals(std::vector<TParam> const &params, int first_param,
+               Link const &upstream, Trigger const &trigger, Link &link)
+      : params_{params}, first_param_{first_param}, upstream_{upstream},
+        trigger_{trigger}, link_{link} {}
+
+  auto curvature() const -> float {
+    return Curvature::scale(value_of(params_[first_param_ + 1]));
+  }
+
+  auto defer() const -> bool { return upstream_.active_; }
+
+  auto duration() const -> float {
+    return MediumDuration::scale(value_of(params_[first_param_ + 2]));
+  }
+
+  auto gate() const -> bool { return trigger_.is_high_; }
+
+  auto gate_edge_fraction() const -> float { return trigger_.edge_fraction_; }
+
+  auto input() const -> float { return upstream_.output_; }
+
+  auto latches_curve() const -> bool {
+    return is_pressed(params_[ParamId::LatchCurve]);
+  }
+
+  auto level() const -> float {
+    return UnipolarVoltage::scale(rotation_of(params_[first_param_]));
+  }
+
+  void output(float voltage) { link_.output_ = voltage; }
+
+  void show_active(bool active) { link_.active_ = active; }
+
+  void show_eoc(bool eoc, float edge_fraction) {
+    link_.show_eoc(eoc, edge_fraction);
+  }
+
+  static auto shape() -> Shape::Id { return Shape::Id::J; };
+
+private:
+  std::vector<TParam> const &params_;
+  int const first_param_;
+  Link const &upstream_;
+  Trigger const &trigger_;
+  Link &link_;
+};
+
+template <typename TParam> class HostageSignals {
+public:
+  HostageSignals(std::vector<TParam> const &params, Link const &upstream,
+                 Trigger const &trigger, Link &link)
+      : params_{params}, upstream_{upstream}, trigger_{trigger}, link_{link} {}
+
+  auto defer() const -> bool { return upstream_.active_; }
+
+  auto duration() const -> float {
+    return MediumDuration::scale(value_of(params_[ParamId::HostageDuration]));
+  }
+
+  auto gate() const -> bool { return trigger_.is_high_; }
+
+  auto input() const -> float { return upstream_.output_; }
+
+  auto mode() const -> envelope::ModeId {
+    return is_pressed(params_[ParamId::HostageMode])
+               ? envelope::ModeId::Sustain
+               : envelope::ModeId::Hold;
+  }
+
+  void output(float voltage) { link_.output_ = voltage; }
+
+  void show_active(bool active) { link_.active_ = active; }
+
+  void show_eoc(bool eoc) { link_.show_eoc(eoc); }
+
+private:
+  std::vector<TParam> const &params_;
+  Link const &upstream_;
+  Trigger const &trigger_;
+  Link &link_;
+};
+} // namespace stage_chain
+} // namespace envelope
+} // namespace dhe
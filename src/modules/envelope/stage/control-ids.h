@@ -4,7 +4,7 @@ namespace dhe {
 namespace envelope {
 namespace stage {
 struct ParamId {
-  enum { Duration, Level, Curvature, Count };
+  enum { Duration, Level, Curvature, LatchCurve, MicroDuration, Count };
 };
 
 struct InputId {
@@ -3,15 +3,25 @@
 #include "components/latch.h"
 #include "components/phase-timer.h"
 #include "components/range.h"
+#include "components/sample-rate.h"
+#include "components/state-machine.h"
+#include "modules/envelope/eoc.h"
 #include "modules/envelope/mode/events.h"
 #include "modules/envelope/mode/mode-ids.h"
+#include "signals/basic.h"
 
 #include <algorithm>
 
 namespace dhe {
 namespace envelope {
 namespace stage {
-
+/**
+ * Runs a single Stage channel, dispatching its modes through a StateMachine.
+ * Stage Chain runs its stage slots on this engine. The polyphonic modules
+ * run stage::PolyEngine instead, whose lanes may each be in a different
+ * mode, so it selects each lane's output by mode mask rather than dispatching
+ * on one mode.
+ */
 template <typename Signals, typename DeferMode, typename InputMode,
           typename GenerateMode, typename LevelMode>
 struct Engine {
@@ -20,40 +30,56 @@ struct Engine {
       : signals_{signals}, defer_mode_{defer_mode}, input_mode_{input_mode},
         generate_mode_{generate_mode}, level_mode_{level_mode} {}
 
+  // Precomputes the EOC pulse's phase increment per sample.
+  void on_sample_rate_change(float sample_time) {
+    eoc_delta_per_sample_ = sample_time / eoc_duration;
+  }
+
   void process(float sample_time) {
+    auto const gate_edge_fraction = signals_.gate_edge_fraction();
+    if (is_asleep_ && !wakes()) {
+      signals_.output(level_);
+      signals_.show_eoc(false, 1.F);
+      return;
+    }
+
     defer_.clock(signals_.defer());
-    gate_.clock(signals_.gate() && !defer_.is_high());
+    gate_.clock(signals_.gate() && !defer_.is_high(), gate_edge_fraction);
 
     auto const new_mode_id = identify_mode();
-    if (mode_id_ != new_mode_id) {
-      enter(new_mode_id);
+    if (modes_.id() != new_mode_id) {
+      modes_.enter(*this, new_mode_id);
     }
 
-    switch (mode_id_) {
-    case ModeId::Defer:
-      defer_mode_.execute();
-      break;
-    case ModeId::Generate: {
-      if (generate_mode_.execute(gate_, sample_time) == Event::Completed) {
-        eoc_timer_.reset();
-        enter(ModeId::Level);
-      }
-    } break;
-    case ModeId::Input:
-      input_mode_.execute();
-      break;
-    case ModeId::Level:
-      level_mode_.execute();
-      break;
-    default:
-      break;
-    }
+    eoc_delta_ = eoc_delta_per_sample_;
+    eoc_edge_fraction_ = 1.F;
+    modes_.execute(*this, sample_time);
 
-    eoc_timer_.advance(sample_time / 1e-3F);
-    signals_.show_eoc(eoc_timer_.in_progress());
+    eoc_timer_.advance(eoc_delta_);
+    signals_.show_eoc(eoc_timer_.in_progress(), eoc_edge_fraction_);
+    is_asleep_ = can_sleep();
+    if (is_asleep_) {
+      level_ = signals_.level();
+    }
   }
 
 private:
+  // The engine sleeps while it rests in level mode with no EOC pulse in
+  // progress. Until the defer signal, the gate signal, or the level changes,
+  // the full process would only clock the latches to the same states, advance
+  // an expired timer, and send the same level, so a sleeping engine sends the
+  // level it stored when it fell asleep. Input mode does not sleep, because
+  // its output follows the input.
+  auto can_sleep() const -> bool {
+    return modes_.id() == ModeId::Level && !defer_.is_edge() &&
+           !gate_.is_edge() && !eoc_timer_.in_progress();
+  }
+
+  auto wakes() const -> bool {
+    return signals_.defer() || signals_.gate() != gate_.is_high() ||
+           signals_.level() != level_;
+  }
+
   auto identify_mode() -> ModeId {
     if (defer_.is_high()) {
       return ModeId::Defer;
@@ -61,51 +87,56 @@ private:
     if (gate_.is_rise()) {
       return ModeId::Generate;
     }
-    return defer_.is_fall() ? ModeId::Input : mode_id_;
+    return defer_.is_fall() ? ModeId::Input : modes_.id();
   }
 
-  void enter(ModeId incoming_mode_id) {
-    switch (mode_id_) {
-    case ModeId::Defer:
-      defer_mode_.exit();
-      break;
-    case ModeId::Generate:
-      generate_mode_.exit();
-      break;
-    case ModeId::Input:
-      input_mode_.exit();
-      break;
-    case ModeId::Level:
-      level_mode_.exit();
-      break;
-    default:
-      break;
-    }
+  template <ModeId I> using Mode = State<ModeId, I>;
+  using Modes = StateMachine<Engine, ModeId, ModeId::Defer, ModeId::Generate,
+                             ModeId::Input, ModeId::Level>;
+  friend Modes;
+
+  void enter(Mode<ModeId::Defer> /*mode*/) { defer_mode_.enter(); }
+  void exit(Mode<ModeId::Defer> /*mode*/) { defer_mode_.exit(); }
+  void execute(Mode<ModeId::Defer> /*mode*/, float /*sample_time*/) {
+    defer_mode_.execute();
+  }
 
-    mode_id_ = incoming_mode_id;
-
-    switch (mode_id_) {
-    case ModeId::Defer:
-      defer_mode_.enter();
-      break;
-    case ModeId::Generate:
-      generate_mode_.enter();
-      break;
-    case ModeId::Input:
-      input_mode_.enter();
-      break;
-    case ModeId::Level:
-      level_mode_.enter();
-      break;
-    default:
-      break;
+  void enter(Mode<ModeId::Generate> /*mode*/) { generate_mode_.enter(); }
+  void exit(Mode<ModeId::Generate> /*mode*/) { generate_mode_.exit(); }
+  void execute(Mode<ModeId::Generate> /*mode*/, float sample_time) {
+    if (generate_mode_.execute(gate_, sample_time) == Event::Completed) {
+      eoc_timer_.reset();
+      // Start the EOC pulse where the curve ended within the sample, and tell
+      // any stage triggered by the EOC how much of the sample remains.
+      auto const leftover_time = generate_mode_.leftover_time();
+      eoc_delta_ = leftover_time / eoc_duration;
+      eoc_edge_fraction_ =
+          sample_time > 0.F ? leftover_time / sample_time : 1.F;
+      modes_.enter(*this, ModeId::Level);
     }
   }
 
+  void enter(Mode<ModeId::Input> /*mode*/) { input_mode_.enter(); }
+  void exit(Mode<ModeId::Input> /*mode*/) { input_mode_.exit(); }
+  void execute(Mode<ModeId::Input> /*mode*/, float /*sample_time*/) {
+    input_mode_.execute();
+  }
+
+  void enter(Mode<ModeId::Level> /*mode*/) { level_mode_.enter(); }
+  void exit(Mode<ModeId::Level> /*mode*/) { level_mode_.exit(); }
+  void execute(Mode<ModeId::Level> /*mode*/, float /*sample_time*/) {
+    level_mode_.execute();
+  }
+
   PhaseTimer eoc_timer_{1.F};
-  ModeId mode_id_{ModeId::Input};
+  float eoc_delta_per_sample_{default_sample_time / eoc_duration};
+  float eoc_delta_{0.F};
+  float eoc_edge_fraction_{1.F};
+  Modes modes_{ModeId::Input};
   Latch defer_{};
   Latch gate_{};
+  bool is_asleep_{false};
+  float level_{0.F};
   Signals &signals_;
   DeferMode &defer_mode_;
   InputMode &input_mode_;
@@ -1,17 +1,13 @@
 #pragma once
 
 #include "control-ids.h"
-#include "engine.h"
+#include "poly-engine.h"
 #include "signals.h"
 
 #include "controls/duration-controls.h"
 #include "controls/knobs.h"
 #include "controls/shape-controls.h"
 #include "controls/voltage-controls.h"
-#include "modules/envelope/mode/defer-mode.h"
-#include "modules/envelope/mode/generate-mode.h"
-#include "modules/envelope/mode/input-mode.h"
-#include "modules/envelope/mode/level-mode.h"
 #include "params/presets.h"
 
 #include "rack.hpp"
@@ -23,9 +19,13 @@ struct Module : public rack::engine::Module {
   Module() {
     config(ParamId::Count, InputId::Count, OutputId::Count);
 
-    MediumDurationKnob::config(this, ParamId::Duration, "Duration");
+    auto *duration_knob =
+        DurationKnob::config(this, ParamId::Duration, "Duration");
+    MicroDurationOption::config(this, ParamId::MicroDuration)
+        ->add_knob(duration_knob);
     UnipolarKnob::config(this, ParamId::Level, "Level");
     CurvatureKnob::config(this, ParamId::Curvature, "Curvature");
+    CurveLatchOption::config(this, ParamId::LatchCurve);
 
     configInput(InputId::Envelope, "Stage");
     configInput(InputId::Defer, "Defer");
@@ -36,7 +36,15 @@ struct Module : public rack::engine::Module {
   }
 
   void process(ProcessArgs const &args) override {
-    engine_.process(args.sampleTime);
+    auto const channels = channel_count(inputs);
+    for (auto &output : outputs) {
+      output.setChannels(channels);
+    }
+    engine_.process(channels, args.sampleTime);
+  }
+
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    engine_.on_sample_rate_change(e.sampleTime);
   }
 
   auto dataToJson() -> json_t * override {
@@ -46,22 +54,13 @@ struct Module : public rack::engine::Module {
   }
 
 private:
-  using RackSignals =
-      Signals<rack::engine::Param, rack::engine::Input, rack::engine::Output>;
-  using DeferM = DeferMode<RackSignals>;
-  using GenerateM = GenerateMode<RackSignals, PhaseTimer>;
-  using InputM = InputMode<RackSignals>;
-  using LevelM = LevelMode<RackSignals>;
-  using RackEngine = Engine<RackSignals, DeferM, InputM, GenerateM, LevelM>;
+  using float_4 = rack::simd::float_4;
+  using RackSignals = Signals<float_4, rack::engine::Param,
+                              rack::engine::Input, rack::engine::Output>;
 
   RackSignals signals_{params, inputs, outputs};
-  PhaseTimer timer_{};
-  DeferM defer_mode_{signals_};
-  InputM input_mode_{signals_};
-  GenerateM generate_mode_{signals_, timer_};
-  LevelM level_mode_{signals_};
-  RackEngine engine_{signals_, defer_mode_, input_mode_, generate_mode_,
-                     level_mode_};
+  PolyEngine<float_4, RackSignals, rack::engine::PORT_MAX_CHANNELS> engine_{
+      signals_};
 };
 } // namespace stage
 } // namespace envelope
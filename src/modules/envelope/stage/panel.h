@@ -2,8 +2,10 @@
 
 #include "control-ids.h"
 
+#include "controls/duration-controls.h"
 #include "controls/knobs.h"
 #include "controls/ports.h"
+#include "controls/shape-controls.h"
 #include "panels/panel-widget.h"
 
 #include "rack.hpp"
@@ -49,6 +51,11 @@ struct Panel : public PanelWidget<Panel> {
     InPort::install(this, InputId::Envelope, column1, y);
     OutPort::install(this, OutputId::Envelope, column3, y);
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    CurveLatchOption::install(menu, getModule(), ParamId::LatchCurve);
+    MicroDurationOption::install(menu, getModule(), ParamId::MicroDuration);
+  }
 };
 } // namespace stage
 } // namespace envelope
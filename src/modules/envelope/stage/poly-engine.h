@@ -0,0 +1,206 @@
+#pragma once
+
+#include "components/sample-rate.h"
+#include "modules/envelope/eoc.h"
+#include "signals/basic.h"
+#include "signals/shape-signals.h"
+
+#include <array>
+#include <cmath>
+
+namespace dhe {
+namespace envelope {
+namespace stage {
+
+/**
+ * Runs a Stage engine on each channel of a polyphonic module. The state of
+ * each channel occupies a lane of a SIMD vector T (such as
+ * rack::simd::float_4), so that each step of the engine processes T::size
+ * channels at once. Instead of switching on each channel's mode, the engine
+ * keeps a lane mask per mode, computes each mode's output for every lane, and
+ * selects each lane's output by its mode's mask.
+ *
+ * A vector of channels sleeps while each of its channels rests in defer,
+ * input, or level mode with no EOC pulse in progress. Until a channel's gate,
+ * defer signal, or output changes, the full process would only repeat the
+ * same outputs, so a sleeping vector sends the outputs it stored when it fell
+ * asleep.
+ */
+template <typename T, typename Signals, int N> class PolyEngine {
+public:
+  PolyEngine(Signals &signals) : signals_{signals} {}
+
+  // Precomputes the EOC pulse's phase increment per sample.
+  void on_sample_rate_change(float sample_time) {
+    eoc_delta_per_sample_ = sample_time / eoc_duration;
+  }
+
+  auto is_asleep(int channel) const -> bool {
+    return lanes_[channel / T::size].asleep_;
+  }
+
+  void process(int channels, float sample_time) {
+    for (auto channel = 0; channel < channels; channel += T::size) {
+      process(lanes_[channel / T::size], channel, sample_time);
+    }
+  }
+
+private:
+  // The state of the channels in one SIMD vector. Each mode mask sets the
+  // lanes in that mode. A lane in no mode is in defer mode if its defer signal
+  // is high, and otherwise in input mode.
+  struct Lanes {
+    T defer_{0.F};
+    T gate_{0.F};
+    T generating_{0.F};
+    T leveling_{0.F};
+    T latched_{0.F};
+    T s_shaped_{0.F};
+    T trigger_voltage_{0.F};
+    T start_voltage_{0.F};
+    T level_{0.F};
+    T curvature_{0.F};
+    T duration_{1.F};
+    T phase_per_second_{1.F};
+    T phase_{0.F};
+    T eoc_phase_{1.F};
+    T output_{0.F};
+    bool asleep_{false};
+  };
+
+  void process(Lanes &lanes, int channel, float sample_time) {
+    using std::fmax;
+    using std::fmin;
+
+    if (lanes.asleep_ && stays_asleep(lanes, channel)) {
+      signals_.output(channel, lanes.output_);
+      signals_.show_active(channel, lanes.defer_);
+      signals_.show_eoc(channel, T{0.F});
+      return;
+    }
+
+    auto const defer = signals_.defer(channel);
+    auto const gate = signals_.gate(channel) & ~defer;
+    auto const rise = gate & ~lanes.gate_;
+    auto const trigger_voltage = signals_.trigger_voltage(channel);
+    auto const input = signals_.input(channel);
+
+    // A rising gate starts (or restarts) a curve. Defer overrides every mode.
+    if (movemask(rise) != 0) {
+      lanes.start_voltage_ = ifelse(rise, input, lanes.start_voltage_);
+      lanes.phase_ = ifelse(rise, T{0.F}, lanes.phase_);
+      lanes.latched_ = ifelse(rise, lane_mask<T>(signals_.latches_curve()),
+                              lanes.latched_);
+    }
+    lanes.generating_ = (lanes.generating_ | rise) & ~defer;
+    lanes.leveling_ = lanes.leveling_ & ~(rise | defer);
+
+    // A latched lane holds the curve it read when its gate rose, so the curve
+    // signals are read only while some generating lane is unlatched or has
+    // just started.
+    auto const reads = lanes.generating_ & (rise | ~lanes.latched_);
+    if (movemask(reads) != 0) {
+      read_curve(lanes, reads, channel);
+    }
+
+    auto eoc_phase = lanes.eoc_phase_;
+    auto eoc_delta = T{eoc_delta_per_sample_};
+    auto output = input;
+    if (movemask(lanes.leveling_) != 0) {
+      output = ifelse(lanes.leveling_, signals_.level(channel), output);
+    }
+
+    if (movemask(lanes.generating_) != 0) {
+      // A curve that starts in this sample advances only through the portion
+      // of the sample that followed the trigger's crossing of the threshold.
+      auto const was_high = lanes.trigger_voltage_ > high_threshold;
+      auto const now_high = trigger_voltage > high_threshold;
+      auto const crossed = rise & (was_high ^ now_high);
+      auto const edge_fraction =
+          ifelse(crossed,
+                 (trigger_voltage - high_threshold) /
+                     (trigger_voltage - lanes.trigger_voltage_),
+                 T{1.F});
+
+      auto const phase_delta =
+          sample_time * edge_fraction * lanes.phase_per_second_;
+      auto const phase = lanes.phase_ + phase_delta;
+      lanes.phase_ =
+          ifelse(lanes.generating_, fmin(phase, T{1.F}), lanes.phase_);
+
+      auto tapered = JShape::apply(lanes.phase_, lanes.curvature_);
+      if (movemask(lanes.generating_ & lanes.s_shaped_) != 0) {
+        tapered = ifelse(lanes.s_shaped_,
+                         SShape::apply(lanes.phase_, lanes.curvature_),
+                         tapered);
+      }
+      auto const span = lanes.level_ - lanes.start_voltage_;
+      auto const curve = lanes.start_voltage_ + span * tapered;
+      output = ifelse(lanes.generating_, curve, output);
+
+      // A completed curve enters level mode and starts the EOC pulse where
+      // the curve ended within the sample.
+      auto const completed = lanes.generating_ & (phase >= T{1.F});
+      auto const leftover_time = fmax(phase - 1.F, T{0.F}) * lanes.duration_;
+      eoc_phase = ifelse(completed, T{0.F}, eoc_phase);
+      eoc_delta = ifelse(completed, leftover_time / eoc_duration, eoc_delta);
+      lanes.leveling_ = lanes.leveling_ | completed;
+      lanes.generating_ = lanes.generating_ & ~completed;
+    }
+
+    lanes.eoc_phase_ = fmin(eoc_phase + eoc_delta, T{1.F});
+    lanes.defer_ = defer;
+    lanes.gate_ = gate;
+    lanes.trigger_voltage_ = trigger_voltage;
+    lanes.output_ = output;
+    lanes.asleep_ =
+        movemask(lanes.generating_ | (lanes.eoc_phase_ < T{1.F})) == 0;
+
+    signals_.output(channel, output);
+    signals_.show_active(channel, defer | lanes.generating_);
+    signals_.show_eoc(channel, lanes.eoc_phase_ < T{1.F});
+  }
+
+  // Whether a sleeping vector stays asleep: no channel's defer signal or gate
+  // has changed, and no channel's input or level would change its output.
+  auto stays_asleep(Lanes &lanes, int channel) const -> bool {
+    auto const defer = signals_.defer(channel);
+    auto const gate = signals_.gate(channel) & ~defer;
+    if (movemask((defer ^ lanes.defer_) | (gate ^ lanes.gate_)) != 0) {
+      return false;
+    }
+    auto output = lanes.output_;
+    if (movemask(~lanes.leveling_) != 0) {
+      output = ifelse(lanes.leveling_, output, signals_.input(channel));
+    }
+    if (movemask(lanes.leveling_) != 0) {
+      output = ifelse(lanes.leveling_, signals_.level(channel), output);
+    }
+    if (movemask(output != lanes.output_) != 0) {
+      return false;
+    }
+    // Track the trigger, so that a curve that wakes the vector starts where
+    // the trigger crossed the threshold.
+    lanes.trigger_voltage_ = signals_.trigger_voltage(channel);
+    return true;
+  }
+
+  void read_curve(Lanes &lanes, T reads, int channel) {
+    auto const duration = signals_.duration(channel);
+    lanes.level_ = ifelse(reads, signals_.level(channel), lanes.level_);
+    lanes.curvature_ =
+        ifelse(reads, signals_.curvature(channel), lanes.curvature_);
+    lanes.s_shaped_ = ifelse(
+        reads, lane_mask<T>(signals_.shape() == Shape::Id::S), lanes.s_shaped_);
+    lanes.duration_ = ifelse(reads, duration, lanes.duration_);
+    lanes.phase_per_second_ =
+        ifelse(reads, T{1.F} / duration, lanes.phase_per_second_);
+  }
+
+  Signals &signals_;
+  float eoc_delta_per_sample_{default_sample_time / eoc_duration};
+  std::array<Lanes, N / T::size> lanes_{};
+};
+} // namespace stage
+} // namespace envelope
+} // namespace dhe
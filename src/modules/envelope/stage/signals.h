@@ -14,42 +14,60 @@ namespace dhe {
 namespace envelope {
 namespace stage {
 
-template <typename TParam, typename TInput, typename TOutput> struct Signals {
+// Reads and writes the channels that start at a given channel, one per lane of
+// a SIMD vector T (such as rack::simd::float_4).
+template <typename T, typename TParam, typename TInput, typename TOutput>
+struct Signals {
   Signals(std::vector<TParam> &params, std::vector<TInput> &inputs,
           std::vector<TOutput> &outputs)
       : params_{params}, inputs_{inputs}, outputs_{outputs} {}
 
-  auto curvature() const -> float {
-    return Curvature::scale(value_of(params_[ParamId::Curvature]));
+  auto curvature(int /*channel*/) const -> T {
+    return T{Curvature::scale(value_of(params_[ParamId::Curvature]))};
   }
 
-  auto defer() const -> bool { return is_high(inputs_[InputId::Defer]); }
+  auto defer(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Defer], channel);
+  }
 
-  auto duration() const -> float {
-    return MediumDuration::scale(value_of(params_[ParamId::Duration]));
+  auto duration(int /*channel*/) const -> T {
+    auto const range = is_pressed(params_[ParamId::MicroDuration])
+                           ? DurationRangeId::Micro
+                           : DurationRangeId::Medium;
+    return T{Duration::scale(value_of(params_[ParamId::Duration]), range)};
   }
 
-  auto gate() const -> bool { return is_high(inputs_[InputId::Trigger]); }
+  auto gate(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Trigger], channel);
+  }
 
-  auto input() const -> float { return voltage_at(inputs_[InputId::Envelope]); }
+  auto input(int channel) const -> T {
+    return voltages_at<T>(inputs_[InputId::Envelope], channel);
+  }
 
-  auto level() const -> float {
+  auto latches_curve() const -> bool {
+    return is_pressed(params_[ParamId::LatchCurve]);
+  }
+
+  auto level(int /*channel*/) const -> T {
     auto const rotation = rotation_of(params_[ParamId::Level]);
-    return UnipolarVoltage::scale(rotation);
+    return T{UnipolarVoltage::scale(rotation)};
+  }
+
+  auto trigger_voltage(int channel) const -> T {
+    return voltages_at<T>(inputs_[InputId::Trigger], channel);
   }
 
-  void output(float voltage) {
-    outputs_[OutputId::Envelope].setVoltage(voltage);
+  void output(int channel, T voltage) {
+    outputs_[OutputId::Envelope].setVoltageSimd(voltage, channel);
   }
 
-  void show_active(bool active) {
-    auto const voltage = UnipolarVoltage::scale(active);
-    outputs_[OutputId::Active].setVoltage(voltage);
+  void show_active(int channel, T active) {
+    outputs_[OutputId::Active].setVoltageSimd(gate_voltages(active), channel);
   }
 
-  void show_eoc(bool eoc) {
-    auto const voltage = UnipolarVoltage::scale(eoc);
-    outputs_[OutputId::Eoc].setVoltage(voltage);
+  void show_eoc(int channel, T eoc) {
+    outputs_[OutputId::Eoc].setVoltageSimd(gate_voltages(eoc), channel);
   }
 
   static auto shape() -> Shape::Id { return Shape::Id::J; };
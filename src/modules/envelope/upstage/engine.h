@@ -4,14 +4,19 @@ namespace dhe {
 namespace envelope {
 namespace upstage {
 
-template <typename Signals> class Engine {
+// Processes the channels of a polyphonic module, one per lane of a SIMD vector
+// T (such as rack::simd::float_4).
+template <typename T, typename Signals> class Engine {
 public:
   Engine(Signals &signals) : signals_{signals} {}
 
-  void process() {
-    auto is_triggered = signals_.is_triggered() && !signals_.is_waiting();
-    signals_.send_trigger(is_triggered);
-    signals_.send_envelope(signals_.level());
+  void process(int channels) {
+    for (auto channel = 0; channel < channels; channel += T::size) {
+      auto const is_triggered =
+          signals_.is_triggered(channel) & ~signals_.is_waiting(channel);
+      signals_.send_trigger(channel, is_triggered);
+      signals_.send_envelope(channel, signals_.level(channel));
+    }
   }
 
 private:
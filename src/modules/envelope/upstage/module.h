@@ -37,7 +37,13 @@ struct Module : public rack::engine::Module {
     configOutput(OutputId::Envelope, "Stage");
   }
 
-  void process(ProcessArgs const & /*args*/) override { engine_.process(); }
+  void process(ProcessArgs const & /*args*/) override {
+    auto const channels = channel_count(inputs);
+    for (auto &output : outputs) {
+      output.setChannels(channels);
+    }
+    engine_.process(channels);
+  }
 
   auto dataToJson() -> json_t * override {
     auto *data = json_object();
@@ -46,12 +52,12 @@ struct Module : public rack::engine::Module {
   }
 
 private:
-  using RackSignals =
-      Signals<rack::engine::Param, rack::engine::Input, rack::engine::Output>;
-  using RackEngine = Engine<RackSignals>;
+  using float_4 = rack::simd::float_4;
+  using RackSignals = Signals<float_4, rack::engine::Param,
+                              rack::engine::Input, rack::engine::Output>;
 
   RackSignals signals_{params, inputs, outputs};
-  RackEngine engine_{signals_};
+  Engine<float_4, RackSignals> engine_{signals_};
 };
 } // namespace upstage
 } // namespace envelope
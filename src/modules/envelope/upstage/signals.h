@@ -11,37 +11,39 @@ namespace dhe {
 namespace envelope {
 namespace upstage {
 
-template <typename TParam, typename TInput, typename TOutput> struct Signals {
+// Reads and writes the channels that start at a given channel, one per lane of
+// a SIMD vector T (such as rack::simd::float_4).
+template <typename T, typename TParam, typename TInput, typename TOutput>
+struct Signals {
   Signals(std::vector<TParam> &params, std::vector<TInput> &inputs,
-
           std::vector<TOutput> &outputs)
       : params_{params}, inputs_{inputs}, outputs_{outputs} {}
 
-  auto is_triggered() const -> bool {
-    return is_high(inputs_[InputId::Trigger]) ||
-           is_pressed(params_[ParamId::Trigger]);
+  auto is_triggered(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Trigger], channel) |
+           lane_mask<T>(is_pressed(params_[ParamId::Trigger]));
   }
 
-  auto is_waiting() const -> bool {
-    return is_high(inputs_[InputId::Wait]) ||
-           is_pressed(params_[ParamId::Wait]);
+  auto is_waiting(int channel) const -> T {
+    return highs_at<T>(inputs_[InputId::Wait], channel) |
+           lane_mask<T>(is_pressed(params_[ParamId::Wait]));
   }
 
-  auto level() const -> float {
-    auto const rotation =
-        rotation_of(params_[ParamId::Level], inputs_[InputId::LevelCv]);
+  auto level(int channel) const -> T {
+    auto const rotation = rotations_of<T>(params_[ParamId::Level],
+                                          inputs_[InputId::LevelCv], channel);
     auto const range_id =
         value_of<VoltageRangeId>(params_[ParamId::LevelRange]);
-    return Voltage::scale(rotation, range_id);
+    return Voltage::range(range_id).scale(rotation);
   }
 
-  void send_envelope(float voltage) {
-    outputs_[OutputId::Envelope].setVoltage(voltage);
+  void send_envelope(int channel, T voltage) {
+    outputs_[OutputId::Envelope].setVoltageSimd(voltage, channel);
   }
 
-  void send_trigger(bool is_triggered) {
-    auto const voltage = UnipolarVoltage::scale(is_triggered);
-    outputs_[OutputId::Trigger].setVoltage(voltage);
+  void send_trigger(int channel, T is_triggered) {
+    outputs_[OutputId::Trigger].setVoltageSimd(gate_voltages(is_triggered),
+                                               channel);
   }
 
 private:
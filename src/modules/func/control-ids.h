@@ -10,6 +10,7 @@ template <int N> struct ParamIds {
     PER_CHANNEL(Operation, N),
     PER_CHANNEL(OffsetRange, N),
     PER_CHANNEL(MultiplierRange, N),
+    ContinueCascade,
     Count
   };
 };
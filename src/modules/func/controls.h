@@ -7,6 +7,7 @@
 #include "operation.h"
 
 #include "controls/knobs.h"
+#include "controls/options.h"
 #include "controls/switches.h"
 
 #include "rack.hpp"
@@ -239,5 +240,19 @@ struct OperationSwitch {
                                           default_value, name, labels);
   }
 };
+// A context menu option that chooses whether a Func module continues the
+// cascade of the Func module to its left.
+struct CascadeOption {
+  static inline void config(rack::engine::Module *module, int param_id) {
+    MenuOption::config(module, param_id, "Cascade",
+                       {"Independent", "Continues from the left"});
+  }
+
+  static inline void install(rack::ui::Menu *menu,
+                             rack::engine::Module *module, int param_id) {
+    MenuOption::install(menu, module, param_id,
+                        "Continue cascade from the Func on the left");
+  }
+};
 } // namespace func
 } // namespace dhe
\ No newline at end of file
@@ -4,40 +4,113 @@
 #include "offset.h"
 #include "operation.h"
 
+#include <array>
+
 namespace dhe {
 
 class Range;
 
 namespace func {
+static auto constexpr max_voices = 16;
+
+/**
+ * The voltages that a channel passes to the next channel, whose input is
+ * normalled to them. Each lane holds the voltages of several voices.
+ */
+template <typename Lane, int LaneSize> struct Upstream {
+  int voices_{1};                                   // NOLINT
+  std::array<Lane, max_voices / LaneSize> lanes_{}; // NOLINT
+};
+
+/**
+ * A channel's operation, expressed as a gain and an offset. Adding an
+ * operand is a gain of 1 and an offset of the operand. Multiplying by an
+ * operand is a gain of the operand and an offset of 0.
+ */
+struct Operator {
+  float gain_;   // NOLINT
+  float offset_; // NOLINT
+};
+
+// The control values from which a channel's operator was computed.
+struct OperatorControls {
+  float operand_;                      // NOLINT
+  Operation operation_;                // NOLINT
+  OffsetRangeId offset_range_;         // NOLINT
+  MultiplierRangeId multiplier_range_; // NOLINT
+
+  auto operator==(OperatorControls const &rhs) const -> bool {
+    return operand_ == rhs.operand_ && operation_ == rhs.operation_ &&
+           offset_range_ == rhs.offset_range_ &&
+           multiplier_range_ == rhs.multiplier_range_;
+  }
+};
+
 template <typename Signals> class FuncEngine {
 public:
-  FuncEngine(Signals &signals) : signals_{signals} {}
-
-  auto apply(int channel, float upstream) const -> float {
-    auto const input = signals_.input(channel, upstream);
-    auto const is_multiply = signals_.operation(channel) == Operation::Multiply;
-    auto const result =
-        is_multiply ? multiply(channel, input) : add(channel, input);
-    signals_.output(channel, result);
-    return result;
+  using Lane = typename Signals::Lane;
+  static auto constexpr lane_size = Signals::lane_size;
+  using UpstreamVoltages = Upstream<Lane, lane_size>;
+
+  FuncEngine(Signals &signals) : signals_{signals} {
+    // No knob yields this operand, so each operator is computed on first use.
+    controls_.fill(OperatorControls{-1.F, Operation::Add,
+                                    OffsetRangeId::Bipolar,
+                                    MultiplierRangeId::Gain});
+  }
+
+  /**
+   * Applies the channel's operator to each voice of its input, or of the
+   * upstream voltages if its input is not connected, and replaces the
+   * upstream voltages with the results. The operator is recomputed only when
+   * the channel's controls change, so applying it to each lane is a single
+   * multiply-add with no branches.
+   */
+  void apply(int channel, UpstreamVoltages &upstream) {
+    auto const is_connected = signals_.is_connected(channel);
+    auto const voices =
+        is_connected ? signals_.voice_count(channel) : upstream.voices_;
+    signals_.set_voice_count(channel, voices);
+    upstream.voices_ = voices;
+
+    if (is_connected) {
+      for (auto lane = 0; lane * lane_size < voices; lane++) {
+        upstream.lanes_[lane] = signals_.input(channel, lane);
+      }
+    }
+
+    auto const op = updated_operator(channel);
+    for (auto lane = 0; lane * lane_size < voices; lane++) {
+      upstream.lanes_[lane] = upstream.lanes_[lane] * op.gain_ + op.offset_;
+      signals_.output(channel, lane, upstream.lanes_[lane]);
+    }
   }
 
 private:
-  auto add(int channel, float augend) const -> float {
-    auto const rotation = signals_.operand(channel);
-    auto const range_id = signals_.offset_range(channel);
-    auto const addend = Offset::scale(rotation, range_id);
-    return augend + addend;
+  auto updated_operator(int channel) -> Operator const & {
+    auto const controls = OperatorControls{
+        signals_.operand(channel), signals_.operation(channel),
+        signals_.offset_range(channel), signals_.multiplier_range(channel)};
+    if (!(controls == controls_[channel])) {
+      controls_[channel] = controls;
+      operators_[channel] = operator_for(controls);
+    }
+    return operators_[channel];
   }
 
-  auto multiply(int channel, float multiplicand) const -> float {
-    auto const rotation = signals_.operand(channel);
-    auto const range_id = signals_.multiplier_range(channel);
-    auto const multiplier = Multiplier::scale(rotation, range_id);
-    return multiplicand * multiplier;
+  static auto operator_for(OperatorControls const &controls) -> Operator {
+    if (controls.operation_ == Operation::Multiply) {
+      return Operator{
+          Multiplier::scale(controls.operand_, controls.multiplier_range_),
+          0.F};
+    }
+    return Operator{1.F,
+                    Offset::scale(controls.operand_, controls.offset_range_)};
   }
 
   Signals &signals_;
+  std::array<OperatorControls, Signals::channel_count> controls_{};
+  std::array<Operator, Signals::channel_count> operators_{};
 };
 } // namespace func
 
@@ -57,6 +57,11 @@ public:
         ->set_offset_range_stepper(offset_range_stepper)
         ->set_multiplier_range_stepper(multiplier_range_stepper);
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    CascadeOption::install(menu, getModule(),
+                           ParamIds<channel_count>::ContinueCascade);
+  }
 };
 } // namespace func
 } // namespace dhe
@@ -58,6 +58,11 @@ public:
           ->set_multiplier_range_stepper(multiplier_range_stepper);
     }
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    CascadeOption::install(menu, getModule(),
+                           ParamIds<channel_count>::ContinueCascade);
+  }
 }; // namespace func
 } // namespace func
 } // namespace dhe
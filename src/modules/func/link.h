@@ -0,0 +1,60 @@
+#pragma once
+
+#include "engine.h"
+
+#include "rack.hpp"
+
+namespace dhe {
+namespace func {
+using RackUpstream = Upstream<rack::simd::float_4, 4>;
+
+/**
+ * A Func module that can continue the cascade of the Func module to its left.
+ * The leftmost module of a cascade evaluates the whole cascade in one pass:
+ * it applies its own channels, then walks rightward, applying the channels of
+ * each neighbor that continues the cascade. A module that continues a cascade
+ * leaves its evaluation to the head of the cascade, so the voltages reach
+ * every module in the same sample.
+ */
+class Link {
+public:
+  // Applies this module's channels to the voltages cascading from its left.
+  virtual void apply(RackUpstream &voltages) = 0;
+
+  // Whether this module continues the cascade of a Func module on its left.
+  virtual auto continues_cascade() const -> bool = 0;
+
+protected:
+  ~Link() = default;
+
+  // Whether this module is evaluated by the head of a cascade to its left.
+  auto is_downstream(rack::engine::Module::Expander const &left) const
+      -> bool {
+    return continues_cascade() && as_link(left.module) != nullptr;
+  }
+
+  // Applies the channels of each module to the right that continues the
+  // cascade. A bypassed module, or one that does not continue the cascade,
+  // ends the walk, and heads its own cascade.
+  static void apply_downstream(rack::engine::Module::Expander const &right,
+                               RackUpstream &voltages) {
+    for (auto *module = right.module; module != nullptr;
+         module = module->rightExpander.module) {
+      auto *link = as_link(module);
+      if (link == nullptr || !link->continues_cascade()) {
+        return;
+      }
+      link->apply(voltages);
+    }
+  }
+
+private:
+  static auto as_link(rack::engine::Module *module) -> Link * {
+    if (module == nullptr || module->isBypassed()) {
+      return nullptr;
+    }
+    return dynamic_cast<Link *>(module);
+  }
+};
+} // namespace func
+} // namespace dhe
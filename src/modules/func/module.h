@@ -2,6 +2,7 @@
 #include "control-ids.h"
 #include "controls.h"
 #include "engine.h"
+#include "link.h"
 #include "multiplier.h"
 #include "offset.h"
 #include "operation.h"
@@ -16,7 +17,7 @@
 namespace dhe {
 namespace func {
 
-template <int N> struct Module : public rack::engine::Module {
+template <int N> struct Module : public rack::engine::Module, public Link {
   using InputId = InputIds<N>;
   using ParamId = ParamIds<N>;
   using OutputId = OutputIds<N>;
@@ -27,15 +28,28 @@ template <int N> struct Module : public rack::engine::Module {
     for (auto i = 0; i < N; i++) {
       config_channel(i);
     }
+    CascadeOption::config(this, ParamId::ContinueCascade);
   }
 
   void process(ProcessArgs const & /*args*/) override {
-    auto upstream = 0.F;
-    for (auto i = 0; i < N; i++) {
-      upstream = func_engine_.apply(i, upstream);
+    if (is_downstream(leftExpander)) {
+      return;
     }
+    auto voltages = RackUpstream{};
+    apply(voltages);
+    apply_downstream(rightExpander, voltages);
   };
 
+  void apply(RackUpstream &voltages) override {
+    for (auto i = 0; i < N; i++) {
+      func_engine_.apply(i, voltages);
+    }
+  }
+
+  auto continues_cascade() const -> bool override {
+    return is_pressed(params[ParamId::ContinueCascade]);
+  }
+
   auto dataToJson() -> json_t * override {
     auto *data = json_object();
     json_object_set_new(data, preset_version_key, json_integer(0));
@@ -79,10 +93,12 @@ private:
     configOutput(OutputId::Channel + channel, port_name);
   }
 
-  using RackSignals = Signals<rack::engine::Param, rack::engine::Input,
-                              rack::engine::Output, N>;
+  using RackSignals =
+      Signals<rack::engine::Param, rack::engine::Input, rack::engine::Output,
+              rack::simd::float_4, N>;
+  using RackFuncEngine = FuncEngine<RackSignals>;
   RackSignals signals_{params, inputs, outputs};
-  FuncEngine<RackSignals> func_engine_{signals_};
+  RackFuncEngine func_engine_{signals_};
 };
 } // namespace func
 } // namespace dhe
@@ -13,9 +13,14 @@
 namespace dhe {
 namespace func {
 
-template <typename TParam, typename TInput, typename TOutput, int N>
+// Each lane of type TLane holds the voltages of several voices.
+template <typename TParam, typename TInput, typename TOutput, typename TLane,
+          int N>
 struct Signals {
   static auto constexpr channel_count = N;
+  using Lane = TLane;
+  static auto constexpr lane_size =
+      static_cast<int>(sizeof(TLane) / sizeof(float));
   using InputId = InputIds<N>;
   using ParamId = ParamIds<N>;
   using OutputId = OutputIds<N>;
@@ -24,9 +29,13 @@ struct Signals {
           std::vector<TOutput> &outputs)
       : params_{params}, inputs_{inputs}, outputs_{outputs} {}
 
-  auto input(int channel, float voltage_if_disconnected) const -> float {
-    return inputs_[InputId::Channel + channel].getNormalVoltage(
-        voltage_if_disconnected);
+  auto input(int channel, int lane) const -> Lane {
+    return inputs_[InputId::Channel + channel].template getVoltageSimd<Lane>(
+        lane * lane_size);
+  }
+
+  auto is_connected(int channel) const -> bool {
+    return inputs_[InputId::Channel + channel].isConnected();
   }
 
   auto multiplier_range(int channel) const -> MultiplierRangeId {
@@ -46,8 +55,17 @@ struct Signals {
     return value_of<Operation>(params_[ParamId::Operation + channel]);
   }
 
-  void output(int channel, float voltage) {
-    outputs_[OutputId::Channel + channel].setVoltage(voltage);
+  void output(int channel, int lane, Lane voltages) {
+    outputs_[OutputId::Channel + channel].setVoltageSimd(voltages,
+                                                         lane * lane_size);
+  }
+
+  void set_voice_count(int channel, int voices) {
+    outputs_[OutputId::Channel + channel].setChannels(voices);
+  }
+
+  auto voice_count(int channel) const -> int {
+    return inputs_[InputId::Channel + channel].getChannels();
   }
 
 private:
@@ -1,48 +1,123 @@
 #pragma once
 
-#include <algorithm>
+#include <cmath>
 
 namespace dhe {
 namespace fuzzy_logic {
 
-struct FuzzyResult {
-  float a_and_b_;
-  float a_or_b_;
-  float a_xor_b_;
-  float a_implies_b_;
-  float b_implies_a_;
+/**
+ * Derives every fuzzy connective from a family's t-norm (conjunction) and
+ * t-conorm (disjunction). Truth values range from 0 (false) to 10 (true), and
+ * each connective evaluates either one voice (V = float) or a lane of voices
+ * (V = a SIMD vector such as rack::simd::float_4).
+ */
+template <typename Norms> struct Engine {
+  template <typename V> static inline auto conjunction(V a, V b) -> V {
+    return Norms::t_norm(a, b);
+  }
+
+  template <typename V> static inline auto disjunction(V a, V b) -> V {
+    return Norms::t_conorm(a, b);
+  }
+
+  template <typename V>
+  static inline auto exclusive_disjunction(V a, V b) -> V {
+    return disjunction(a, b) - conjunction(a, b);
+  }
+
+  template <typename V> static inline auto implication(V a, V b) -> V {
+    return disjunction(10.F - a, b);
+  }
+
+  template <typename V>
+  static inline auto converse_implication(V a, V b) -> V {
+    return implication(b, a);
+  }
 };
 
-struct HEngine {
-  static inline auto compute(float a, float b) -> FuzzyResult {
-    auto const not_a = 10.F - a;
-    auto const not_b = 10.F - b;
-    auto const a_and_b = a * b * 0.1F;
-    auto const a_or_b = a + b - a_and_b;
-    return FuzzyResult{
-        .a_and_b_ = a_and_b,
-        .a_or_b_ = a_or_b,
-        .a_xor_b_ = a_or_b - a_and_b,
-        .a_implies_b_ = not_a + a_and_b,
-        .b_implies_a_ = not_b + a_and_b,
-    };
+// Rack's SIMD vectors overload fmin and fmax in their own namespace, so the
+// norms call them unqualified after bringing the std versions into scope.
+
+template <typename V> static inline auto clamp_truth(V v) -> V {
+  using std::fmax;
+  using std::fmin;
+  return fmin(fmax(v, V{0.F}), V{10.F});
+}
+
+// Hyperbolic paraboloid: the algebraic product and sum
+struct ProductNorms {
+  template <typename V> static inline auto t_norm(V a, V b) -> V {
+    return a * b * 0.1F;
+  }
+
+  template <typename V> static inline auto t_conorm(V a, V b) -> V {
+    return a + b - t_norm(a, b);
   }
 };
 
-struct ZEngine {
-  static inline auto compute(float a, float b) -> FuzzyResult {
-    auto const not_a = 10.F - a;
-    auto const not_b = 10.F - b;
-    auto const a_and_b = std::min(a, b);
-    auto const a_or_b = std::max(a, b);
-    return FuzzyResult{
-        .a_and_b_ = a_and_b,
-        .a_or_b_ = a_or_b,
-        .a_xor_b_ = a_or_b - a_and_b,
-        .a_implies_b_ = std::max(not_a, b),
-        .b_implies_a_ = std::max(a, not_b),
-    };
+// Zadeh: the minimum and maximum
+struct MinMaxNorms {
+  template <typename V> static inline auto t_norm(V a, V b) -> V {
+    using std::fmin;
+    return fmin(a, b);
+  }
+
+  template <typename V> static inline auto t_conorm(V a, V b) -> V {
+    using std::fmax;
+    return fmax(a, b);
   }
 };
+
+// Łukasiewicz: the bounded difference and bounded sum
+struct LukasiewiczNorms {
+  template <typename V> static inline auto t_norm(V a, V b) -> V {
+    using std::fmax;
+    return fmax(a + b - 10.F, V{0.F});
+  }
+
+  template <typename V> static inline auto t_conorm(V a, V b) -> V {
+    using std::fmin;
+    return fmin(a + b, V{10.F});
+  }
+};
+
+// Hamacher: the Hamacher product and its dual. Operands are clamped to the
+// range of truth values to keep the denominators positive.
+struct HamacherNorms {
+  template <typename V> static inline auto t_norm(V a, V b) -> V {
+    using std::fmax;
+    auto const x = clamp_truth(a);
+    auto const y = clamp_truth(b);
+    // Zero only when both operands are 0, which makes the product 0.
+    auto const denominator = fmax(x + y - x * y * 0.1F, V{1e-6F});
+    return x * y / denominator;
+  }
+
+  template <typename V> static inline auto t_conorm(V a, V b) -> V {
+    return 10.F - t_norm(10.F - a, 10.F - b);
+  }
+};
+
+// Einstein: the Einstein product and sum. Operands are clamped to the range of
+// truth values to keep the denominators positive.
+struct EinsteinNorms {
+  template <typename V> static inline auto t_norm(V a, V b) -> V {
+    auto const x = clamp_truth(a);
+    auto const y = clamp_truth(b);
+    return 10.F * x * y / (200.F - 10.F * (x + y) + x * y);
+  }
+
+  template <typename V> static inline auto t_conorm(V a, V b) -> V {
+    auto const x = clamp_truth(a);
+    auto const y = clamp_truth(b);
+    return 100.F * (x + y) / (100.F + x * y);
+  }
+};
+
+using HEngine = Engine<ProductNorms>;
+using ZEngine = Engine<MinMaxNorms>;
+using LEngine = Engine<LukasiewiczNorms>;
+using HpEngine = Engine<HamacherNorms>;
+using EEngine = Engine<EinsteinNorms>;
 } // namespace fuzzy_logic
 } // namespace dhe
@@ -12,6 +12,12 @@ void init(rack::plugin::Plugin *plugin) {
       rack::createModel<Module<HEngine>, Panel<HPanel>>("FuzzyLogicH"));
   plugin->addModel(
       rack::createModel<Module<ZEngine>, Panel<ZPanel>>("FuzzyLogicZ"));
+  plugin->addModel(
+      rack::createModel<Module<LEngine>, Panel<LPanel>>("FuzzyLogicL"));
+  plugin->addModel(
+      rack::createModel<Module<HpEngine>, Panel<HpPanel>>("FuzzyLogicHp"));
+  plugin->addModel(
+      rack::createModel<Module<EEngine>, Panel<EPanel>>("FuzzyLogicE"));
 }
 
 } // namespace fuzzy_logic
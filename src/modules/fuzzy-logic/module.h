@@ -2,6 +2,7 @@
 
 #include "control-ids.h"
 
+#include "components/connected-outputs.h"
 #include "controls/buttons.h"
 #include "controls/switches.h"
 #include "controls/voltage-controls.h"
@@ -11,11 +12,16 @@
 
 #include "rack.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace dhe {
 
 namespace fuzzy_logic {
 
 template <typename TEngine> struct Module : public rack::engine::Module {
+  using float_4 = rack::simd::float_4;
+
   Module() {
     config(ParamId::Count, InputId::Count, OutputId::Count);
     configInput(InputId::A + 0, "A");
@@ -56,34 +62,49 @@ template <typename TEngine> struct Module : public rack::engine::Module {
   void process(ProcessArgs const & /*ignored*/) override {
     auto const voltage_offset = value_of(params[ParamId::LevelRange]) * 5.F;
     for (auto i = 0; i < 2; i++) {
-      auto const a_input = inputs[InputId::A + i].getVoltage() + voltage_offset;
-      auto const b_input = inputs[InputId::B + i].getVoltage() + voltage_offset;
-
-      auto const a =
-          is_pressed(params[(ParamId::NegateA + i)]) ? 10.F - a_input : a_input;
-      auto const b =
-          is_pressed(params[(ParamId::NegateB + i)]) ? 10.F - b_input : b_input;
-
-      auto const out = TEngine::compute(a, b);
-
-      set_outputs(OutputId::And + i, OutputId::Nand + i, out.a_and_b_,
-                  voltage_offset);
-      set_outputs(OutputId::Or + i, OutputId::Nor + i, out.a_or_b_,
-                  voltage_offset);
-      set_outputs(OutputId::Xor + i, OutputId::Xnor + i, out.a_xor_b_,
-                  voltage_offset);
-      set_outputs(OutputId::Implication + i, OutputId::Nonimplication + i,
-                  out.a_implies_b_, voltage_offset);
-      set_outputs(OutputId::ConverseImplication + i,
-                  OutputId::ConverseNonimplication + i, out.b_implies_a_,
-                  voltage_offset);
+      auto &connected = connected_[i];
+      connected.update(outputs, writers_[i]);
+      if (connected.size() == 0) {
+        continue;
+      }
+      auto &a_input = inputs[InputId::A + i];
+      auto &b_input = inputs[InputId::B + i];
+      auto const channels =
+          std::max({1, a_input.getChannels(), b_input.getChannels()});
+      for (auto const &writer : connected) {
+        outputs[writer.output_id_].setChannels(channels);
+      }
+
+      auto const negate_a = is_pressed(params[(ParamId::NegateA + i)]);
+      auto const negate_b = is_pressed(params[(ParamId::NegateB + i)]);
+      for (auto c = 0; c < channels; c += 4) {
+        auto const a_voltage =
+            a_input.getPolyVoltageSimd<float_4>(c) + voltage_offset;
+        auto const b_voltage =
+            b_input.getPolyVoltageSimd<float_4>(c) + voltage_offset;
+        auto const a = negate_a ? 10.F - a_voltage : a_voltage;
+        auto const b = negate_b ? 10.F - b_voltage : b_voltage;
+        auto const lane = Lane{a, b, c, voltage_offset};
+        write<&TEngine::template conjunction<float_4>>(
+            connected, OutputId::And + i, lane);
+        write<&TEngine::template disjunction<float_4>>(
+            connected, OutputId::Or + i, lane);
+        write<&TEngine::template exclusive_disjunction<float_4>>(
+            connected, OutputId::Xor + i, lane);
+        write<&TEngine::template implication<float_4>>(
+            connected, OutputId::Implication + i, lane);
+        write<&TEngine::template converse_implication<float_4>>(
+            connected, OutputId::ConverseImplication + i, lane);
+      }
     }
   }
 
-  void set_outputs(int output_id, int negated_output_id, float voltage,
-                   float offset) {
-    outputs[output_id].setVoltage(voltage - offset);
-    outputs[negated_output_id].setVoltage(10.F - voltage - offset);
+  void onPortChange(PortChangeEvent const &e) override {
+    if (e.type == rack::engine::Port::OUTPUT) {
+      for (auto &connected : connected_) {
+        connected.invalidate();
+      }
+    }
   }
 
   auto dataToJson() -> json_t * override {
@@ -91,6 +112,60 @@ template <typename TEngine> struct Module : public rack::engine::Module {
     json_object_set_new(data, preset_version_key, json_integer(0));
     return data;
   }
+
+private:
+  using Connective = float_4 (*)(float_4, float_4);
+
+  struct Writer {
+    int output_id_; // NOLINT
+  };
+
+  // The truth values of one lane of channels, the first channel in the lane,
+  // and the offset to subtract from each output voltage.
+  struct Lane {
+    float_4 a_;            // NOLINT
+    float_4 b_;            // NOLINT
+    int channel_;          // NOLINT
+    float voltage_offset_; // NOLINT
+  };
+
+  using Writers = std::array<Writer, OutputId::Count / 2>;
+
+  // Writes the connective to its output, and its negation to the output two
+  // ids past it, if either is connected. The connective is a template
+  // argument, so that each call to it is direct and can be inlined.
+  template <Connective C>
+  void write(ConnectedOutputs<Writer, OutputId::Count / 2> const &connected,
+             int output_id, Lane const &lane) {
+    auto const negation_id = output_id + 2;
+    auto const writes_truth = connected.contains(output_id);
+    auto const writes_negation = connected.contains(negation_id);
+    if (!writes_truth && !writes_negation) {
+      return;
+    }
+    auto const truth = C(lane.a_, lane.b_);
+    if (writes_truth) {
+      outputs[output_id].setVoltageSimd(truth - lane.voltage_offset_,
+                                        lane.channel_);
+    }
+    if (writes_negation) {
+      outputs[negation_id].setVoltageSimd(
+          10.F - truth - lane.voltage_offset_, lane.channel_);
+    }
+  }
+
+  // Pair i's outputs alternate between each connective and its negation, and
+  // each output is two ids past the previous one.
+  static auto writers_for(int i) -> Writers {
+    auto writers = Writers{};
+    for (auto k = 0; k < OutputId::Count / 2; k++) {
+      writers[k] = Writer{OutputId::And + i + 2 * k};
+    }
+    return writers;
+  }
+
+  std::array<Writers, 2> writers_{writers_for(0), writers_for(1)};
+  std::array<ConnectedOutputs<Writer, OutputId::Count / 2>, 2> connected_{};
 };
 } // namespace fuzzy_logic
 } // namespace dhe
@@ -21,6 +21,18 @@ struct ZPanel {
   static auto constexpr panel_file = "fuzzy-logic-z";
 };
 
+struct LPanel {
+  static auto constexpr panel_file = "fuzzy-logic-l";
+};
+
+struct HpPanel {
+  static auto constexpr panel_file = "fuzzy-logic-hp";
+};
+
+struct EPanel {
+  static auto constexpr panel_file = "fuzzy-logic-e";
+};
+
 template <typename S> struct Panel : public PanelWidget<Panel<S>> {
   static auto constexpr hp = 9;
   static auto constexpr panel_file = S::panel_file;
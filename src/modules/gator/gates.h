@@ -0,0 +1,97 @@
+#pragma once
+
+#include "control-ids.h"
+
+#include <array>
+
+namespace dhe {
+namespace gator {
+
+/**
+ * Records which inputs are high in each channel. Bit i of a channel's bitset
+ * is set if input i is high in that channel.
+ */
+class HighInputs {
+public:
+  static auto constexpr max_channels = 16;
+
+  void clear() { bits_.fill(0U); }
+
+  /**
+   * Records which channels of an input are high, for four channels starting
+   * at first_channel. Bit k of lane_highs (such as from a SIMD movemask) is
+   * set if the input is high in channel first_channel + k.
+   */
+  void add(int input, int first_channel, unsigned int lane_highs) {
+    for (auto k = 0; k < 4; k++) {
+      bits_[first_channel + k] |= ((lane_highs >> k) & 1U) << input;
+    }
+  }
+
+  auto count(int channel) const -> int {
+    return __builtin_popcount(bits_[channel]);
+  }
+
+private:
+  std::array<unsigned int, max_channels> bits_{};
+};
+
+/**
+ * Computes every gate's output from the number of high inputs. Bit g of the
+ * result is set if the gate whose output id is g is high. Each gate is low if
+ * no inputs are connected.
+ */
+static inline auto gate_outputs(int high_count, int connected_count)
+    -> unsigned int {
+  if (connected_count == 0) {
+    return 0U;
+  }
+  auto const is_odd = (high_count & 1) != 0;
+  auto const outputs = std::array<bool, OutputId::Count>{
+      high_count == connected_count, // And
+      high_count < connected_count,  // Nand
+      high_count > 0,                // Or
+      high_count == 0,               // Nor
+      !is_odd,                       // Even
+      is_odd,                        // Odd
+      high_count == 1,               // Xor
+      high_count != 1,               // Xnor
+  };
+  auto bits = 0U;
+  for (auto g = 0; g < OutputId::Count; g++) {
+    bits |= (outputs[g] ? 1U : 0U) << g;
+  }
+  return bits;
+}
+
+/**
+ * A table of every gate's output for each number of high inputs. The table
+ * depends only on which inputs are connected, so a module rebuilds it only
+ * when the connected inputs change, and each channel's gates are then a
+ * single lookup.
+ */
+class GateTable {
+public:
+  // Rebuilds the table if the connected inputs changed. Bit i of
+  // connected_inputs is set if input i is connected.
+  void connect(unsigned int connected_inputs) {
+    if (connected_inputs == connected_inputs_) {
+      return;
+    }
+    connected_inputs_ = connected_inputs;
+    auto const connected_count = __builtin_popcount(connected_inputs);
+    for (auto high_count = 0; high_count <= input_count; high_count++) {
+      outputs_[high_count] = gate_outputs(high_count, connected_count);
+    }
+  }
+
+  auto outputs(int high_count) const -> unsigned int {
+    return outputs_[high_count];
+  }
+
+private:
+  unsigned int connected_inputs_{0U};
+  std::array<unsigned int, input_count + 1> outputs_{};
+};
+} // namespace gator
+} // namespace dhe
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "control-ids.h"
+#include "gates.h"
+
+#include "components/connected-outputs.h"
 #include "controls/buttons.h"
 #include "params/presets.h"
 #include "signals/basic.h"
 
 #include "rack.hpp"
 
+#include <algorithm>
+#include <array>
 #include <string>
 
 namespace dhe {
@@ -14,6 +19,8 @@ namespace dhe {
 namespace gator {
 
 class Module : public rack::engine::Module {
+  using float_4 = rack::simd::float_4;
+
 public:
   Module() {
     config(ParamId::Count, InputId::Count, OutputId::Count);
@@ -35,26 +42,52 @@ public:
   }
 
   void process(ProcessArgs const & /*ignored*/) override {
-    auto connected_count = 0;
-    auto high_count = 0;
+    connected_.update(outputs, writers_);
+    if (connected_.size() == 0) {
+      return;
+    }
+
+    auto channels = 1;
+    for (auto i = 0; i < InputId::Count; i++) {
+      channels = std::max(channels, inputs[InputId::Signal + i].getChannels());
+    }
 
+    // Bit i of connected_inputs is set if input i is connected.
+    auto connected_inputs = 0U;
+    high_inputs_.clear();
     for (auto i = 0; i < InputId::Count; i++) {
-      if (inputs[i].isConnected()) {
-        connected_count++;
-        if (is_high(inputs[(InputId::Signal + i)]) !=
-            is_pressed(params[ParamId::NegateSignal + i])) {
-          high_count++;
-        }
+      auto &input = inputs[InputId::Signal + i];
+      if (!input.isConnected()) {
+        continue;
+      }
+      connected_inputs |= 1U << i;
+      auto const negation =
+          is_pressed(params[ParamId::NegateSignal + i]) ? 0xFU : 0U;
+      for (auto c = 0; c < channels; c += 4) {
+        auto const voltages = input.getPolyVoltageSimd<float_4>(c);
+        auto const highs = voltages > high_threshold;
+        auto const lane_highs =
+            static_cast<unsigned int>(rack::simd::movemask(highs)) ^ negation;
+        high_inputs_.add(i, c, lane_highs);
+      }
+    }
+    gate_table_.connect(connected_inputs);
+
+    for (auto const &writer : connected_) {
+      outputs[writer.output_id_].setChannels(channels);
+    }
+    for (auto c = 0; c < channels; c++) {
+      auto const gates = gate_table_.outputs(high_inputs_.count(c));
+      for (auto const &writer : connected_) {
+        auto const is_high = (gates & (1U << writer.output_id_)) != 0U;
+        outputs[writer.output_id_].setVoltage(is_high ? 10.F : 0.F, c);
       }
     }
+  }
 
-    if (connected_count == 0) {
-      set_all_outputs_false();
-    } else {
-      set_outputs(OutputId::And, OutputId::Nand, high_count == connected_count);
-      set_outputs(OutputId::Or, OutputId::Nor, high_count > 0);
-      set_outputs(OutputId::Odd, OutputId::Even, (high_count & 1) > 0);
-      set_outputs(OutputId::Xor, OutputId::Xnor, high_count == 1);
+  void onPortChange(PortChangeEvent const &e) override {
+    if (e.type == rack::engine::Port::OUTPUT) {
+      connected_.invalidate();
     }
   }
 
@@ -65,17 +98,20 @@ public:
   }
 
 private:
-  void set_all_outputs_false() {
-    for (auto i = 0; i < OutputId::Count; i++) {
-      outputs[i].setVoltage(0.F);
-    }
-  }
+  struct Writer {
+    int output_id_; // NOLINT
+  };
 
-  void set_outputs(int output_id, int negated_output_id, bool value) {
-    auto const voltage = value ? 10.F : 0.F;
-    outputs[output_id].setVoltage(voltage);
-    outputs[negated_output_id].setVoltage(10.F - voltage);
-  }
+  using Writers = std::array<Writer, OutputId::Count>;
+
+  Writers const writers_{
+      Writer{OutputId::And},  Writer{OutputId::Nand}, Writer{OutputId::Or},
+      Writer{OutputId::Nor},  Writer{OutputId::Even}, Writer{OutputId::Odd},
+      Writer{OutputId::Xor},  Writer{OutputId::Xnor},
+  };
+  ConnectedOutputs<Writer, OutputId::Count> connected_{};
+  GateTable gate_table_{};
+  HighInputs high_inputs_{};
 };
 
 } // namespace gator
@@ -6,6 +6,7 @@
 #include "generator.h"
 
 #include "components/cxmath.h"
+#include "components/throttle.h"
 #include "controls/knobs.h"
 #include "controls/shape-controls.h"
 #include "controls/step-selection-controls.h"
@@ -97,6 +98,10 @@ public:
 
   void process(ProcessArgs const & /*args*/) override { controller_.execute(); }
 
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    light_throttle_.set_interval(light_update_interval_at(e.sampleRate));
+  }
+
   auto anchor_mode(AnchorType type, int step) const -> AnchorMode {
     auto const base = type == AnchorType::Phase0
                           ? ParamId::StepPhase0AnchorMode
@@ -155,11 +160,19 @@ public:
   void output(float voltage) { outputs[OutputId::Out].setVoltage(voltage); }
 
   void show_position(int step, float phase) {
-    auto const completed_brightness = brightness_range.scale(phase);
-    auto const remaining_brightness = 1.F - completed_brightness;
-    set_lights(step, completed_brightness, remaining_brightness);
-    outputs[OutputId::StepNumber].setVoltage(static_cast<float>(step + 1) *
-                                             10.F / static_cast<float>(N));
+    // Always light a newly entered step. After that, update the lights only as
+    // often as the UI can show them.
+    auto const is_new_step = step != lit_step_;
+    if (is_new_step) {
+      outputs[OutputId::StepNumber].setVoltage(static_cast<float>(step + 1) *
+                                               step_number_voltage);
+    }
+    if (light_throttle_.tick() || is_new_step) {
+      lit_step_ = step;
+      auto const completed_brightness = brightness_range.scale(phase);
+      auto const remaining_brightness = 1.F - completed_brightness;
+      set_lights(step, completed_brightness, remaining_brightness);
+    }
     outputs[OutputId::StepPhase].setVoltage(phase * 10.F);
   }
 
@@ -174,6 +187,9 @@ public:
   }
 
 private:
+  // The step number output's voltage per step
+  static auto constexpr step_number_voltage = 10.F / static_cast<float>(N);
+
   using AnchorT = Anchor<Module>;
   using GeneratorT = Generator<Module, AnchorT>;
   using ControllerT = Controller<Module, GeneratorT, N>;
@@ -182,6 +198,8 @@ private:
   AnchorT phase_1_anchor_{*this, AnchorType::Phase1};
   GeneratorT generator_{*this, phase_0_anchor_, phase_1_anchor_};
   ControllerT controller_{*this, generator_};
+  Throttle light_throttle_{light_update_interval};
+  int lit_step_{-1};
 
   void set_lights(int step, float completed_brightness,
                   float remaining_brightness) {
@@ -72,24 +72,55 @@ static inline auto label(AnchorType type) -> char const * {
 template <typename Signals> struct Anchor {
   Anchor(Signals &signals, AnchorType type) : signals_{signals}, type_{type} {}
 
+  // Forgets the cached step sources and levels. Call once per sample, so that
+  // at audio rate the anchor reads each step's source and level at most once
+  // per sample, however many times the sequence enters the step.
+  void refresh() { cached_steps_ = 0U; }
+
   void enter(int step) {
     step_ = step;
     sample_ = source_voltage();
   }
 
+  // Whether the anchor currently reports the voltage sampled on entry. The
+  // mode may change at any time during the step, so this reads it each time.
+  auto is_sampled() const -> bool {
+    return signals_.anchor_mode(type_, step_) == AnchorMode::Sample;
+  }
+
   auto voltage() const -> float {
-    auto const mode = signals_.anchor_mode(type_, step_);
-    return mode == AnchorMode::Track ? source_voltage() : sample_;
+    return is_sampled() ? sample_ : source_voltage();
   }
 
 private:
+  struct StepSource {
+    AnchorSource source_;
+    float level_;
+  };
+
   Signals &signals_{};
   AnchorType type_{};
   int step_{};
   float sample_{};
+  mutable unsigned int cached_steps_{};
+  mutable std::array<StepSource, Signals::step_count> step_sources_{};
+
+  auto step_source() const -> StepSource const & {
+    auto &step_source = step_sources_[static_cast<size_t>(step_)];
+    auto const step_bit = 1U << step_;
+    if ((cached_steps_ & step_bit) == 0U) {
+      step_source.source_ = signals_.anchor_source(type_, step_);
+      step_source.level_ = step_source.source_ == AnchorSource::Level
+                               ? signals_.anchor_level(type_, step_)
+                               : 0.F;
+      cached_steps_ |= step_bit;
+    }
+    return step_source;
+  }
 
   auto source_voltage() const -> float {
-    switch (signals_.anchor_source(type_, step_)) {
+    auto const &step_source = this->step_source();
+    switch (step_source.source_) {
     case AnchorSource::InA:
       return signals_.in_a();
     case AnchorSource::InB:
@@ -97,7 +128,7 @@ private:
     case AnchorSource::InC:
       return signals_.in_c();
     case AnchorSource::Level:
-      return signals_.anchor_level(type_, step_);
+      return step_source.level_;
     case AnchorSource::Out:
       return signals_.output();
     default:
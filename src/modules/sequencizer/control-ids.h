@@ -32,6 +32,7 @@ template <int N> struct ParamIds {
     ONE_PER_STEP(StepStartAnchorSource, N),
     ONE_PER_STEP(StepSustainMode, N),
     ONE_PER_STEP(StepTriggerMode, N),
+    AudioRate,
     Count,
   };
 };
@@ -47,6 +48,7 @@ struct InputId {
     Loop,
     Reset,
     Run,
+    Position,
     Count,
   };
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "components/cxmath.h"
 #include "components/phase-timer.h"
 #include "components/range.h"
 #include "signals/shape-signals.h"
@@ -15,23 +16,31 @@ public:
       : signals_{signals}, start_anchor_{start_anchor}, end_anchor_{
                                                             end_anchor} {}
 
-  void start(int step) {
+  void start(int step, float phase = 0.F) {
     step_ = step;
-    timer_.reset();
+    timer_ = PhaseTimer{phase};
     signals_.show_progress(step_, timer_.phase());
     start_anchor_.enter(step_);
     end_anchor_.enter(step_);
+    // While both anchors are sampled, the step's voltage range is the range on
+    // entry, so compute it once here instead of on every sample.
+    range_ = anchor_range();
   }
 
   auto generate(float sample_time) -> GeneratorStatus {
     auto const duration = signals_.duration(step_);
     auto const curvature = signals_.curvature(step_);
-    auto const start_voltage = start_anchor_.voltage();
-    auto const end_voltage = end_anchor_.voltage();
-    auto const range = Range{start_voltage, end_voltage};
+    // Check the anchor modes on every sample, so that switching an anchor
+    // between Sample and Track takes effect mid-step.
+    auto const is_static =
+        start_anchor_.is_sampled() && end_anchor_.is_sampled();
+    auto const range = is_static ? range_ : anchor_range();
     auto const shape = signals_.shape(step_);
 
-    timer_.advance(sample_time / duration);
+    auto const phase_delta = sample_time / duration;
+    auto const excess_phase = timer_.phase() + phase_delta - 1.F;
+    leftover_time_ = cx::max(excess_phase, 0.F) * duration;
+    timer_.advance(phase_delta);
     auto const phase = timer_.phase();
     auto const out_voltage = range.scale(Shape::apply(phase, shape, curvature));
     signals_.output(out_voltage);
@@ -40,13 +49,23 @@ public:
                                 : GeneratorStatus::Completed;
   }
 
+  // The portion of the most recently generated sample that remained after the
+  // step completed.
+  auto leftover_time() const -> float { return leftover_time_; }
+
   void stop() { signals_.show_inactive(step_); }
 
 private:
+  auto anchor_range() const -> Range {
+    return Range{start_anchor_.voltage(), end_anchor_.voltage()};
+  }
+
   Signals &signals_;
   Anchor &start_anchor_;
   Anchor &end_anchor_;
   PhaseTimer timer_{};
+  Range range_{0.F, 0.F};
+  float leftover_time_{0.F};
   int step_{0};
 };
 } // namespace sequencizer
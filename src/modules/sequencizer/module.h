@@ -13,6 +13,7 @@
 #include "controls/buttons.h"
 #include "controls/duration-controls.h"
 #include "controls/knobs.h"
+#include "controls/options.h"
 #include "controls/shape-controls.h"
 #include "controls/step-selection-controls.h"
 #include "controls/switches.h"
@@ -42,6 +43,7 @@ public:
     configInput(InputId::Loop, "Loop");
     Button::config(this, ParamId::Reset, "Reset");
     configInput(InputId::Reset, "Reset");
+    configInput(InputId::Position, "Position");
 
     SelectionStartKnob::config<N>(this, ParamId::SelectionStart, "Start step");
     SelectionLengthKnob::config<N>(this, ParamId::SelectionLength,
@@ -115,14 +117,25 @@ public:
 
     GainKnob::config(this, ParamId::DurationMultiplier, "Duration multiplier");
     configInput(InputId::DurationMultiplierCV, "Duration multipler CV");
+
+    MenuOption::config(this, ParamId::AudioRate, "Audio rate steps",
+                       {"Off", "On"});
   }
 
   ~Module() override = default;
 
   void process(ProcessArgs const &args) override {
+    step_selector_.refresh();
+    start_anchor_.refresh();
+    end_anchor_.refresh();
     sequence_controller_.execute(args.sampleTime);
   }
 
+  void onSampleRateChange(SampleRateChangeEvent const &e) override {
+    signals_.on_sample_rate_change(e.sampleRate);
+    sequence_controller_.on_sample_rate_change(e.sampleTime);
+  }
+
   auto dataToJson() -> json_t * override {
     auto *data = json_object();
     json_object_set_new(data, preset_version_key, json_integer(0));
@@ -9,6 +9,7 @@
 #include "controls/buttons.h"
 #include "controls/duration-controls.h"
 #include "controls/knobs.h"
+#include "controls/options.h"
 #include "controls/ports.h"
 #include "controls/shape-controls.h"
 #include "controls/step-selection-controls.h"
@@ -51,6 +52,8 @@ static auto constexpr global_controls_top_y = top + port_box_ascent;
 static auto constexpr global_controls_bottom_y = bottom - port_box_descent;
 static auto constexpr global_controls_dy =
     (global_controls_bottom_y - global_controls_top_y) / 4.F;
+static auto constexpr sequence_controls_dy =
+    (global_controls_bottom_y - global_controls_top_y) / 5.F;
 
 using ProgressLight =
     rack::componentlibrary::SmallLight<rack::componentlibrary::GreenRedLight>;
@@ -81,12 +84,15 @@ template <typename TSize> struct Panel : public PanelWidget<Panel<TSize>> {
     using LightId = LightIds<step_count>;
 
     auto static constexpr run_y =
-        global_controls_top_y + 0.F * global_controls_dy;
-    auto constexpr loop_y = global_controls_top_y + 1.F * global_controls_dy;
+        global_controls_top_y + 0.F * sequence_controls_dy;
+    auto constexpr loop_y = global_controls_top_y + 1.F * sequence_controls_dy;
     auto constexpr selection_y =
-        global_controls_top_y + 2.F * global_controls_dy;
-    auto constexpr gate_y = global_controls_top_y + 3.F * global_controls_dy;
-    auto constexpr reset_y = global_controls_top_y + 4.F * global_controls_dy;
+        global_controls_top_y + 2.F * sequence_controls_dy;
+    auto constexpr gate_y = global_controls_top_y + 3.F * sequence_controls_dy;
+    auto constexpr reset_y =
+        global_controls_top_y + 4.F * sequence_controls_dy;
+    auto constexpr position_y =
+        global_controls_top_y + 5.F * sequence_controls_dy;
 
     InPort::install(this, InputId::Run, sequence_controls_x, run_y);
     Button::install<Toggle>(this, ParamId::Run,
@@ -125,6 +131,8 @@ template <typename TSize> struct Panel : public PanelWidget<Panel<TSize>> {
                                sequence_controls_x + button_port_distance,
                                reset_y);
 
+    InPort::install(this, InputId::Position, sequence_controls_x, position_y);
+
     auto constexpr level_y = global_controls_top_y + 0.F * global_controls_dy;
     auto constexpr global_duration_y =
         global_controls_top_y + 1.F * global_controls_dy;
@@ -252,6 +260,11 @@ template <typename TSize> struct Panel : public PanelWidget<Panel<TSize>> {
                               enabled_y);
     }
   }
+
+  void appendContextMenu(rack::ui::Menu *menu) override {
+    MenuOption::install(menu, this->getModule(),
+                        ParamIds<step_count>::AudioRate, "Audio rate steps");
+  }
 }; // namespace dhe
 } // namespace sequencizer
 } // namespace dhe
@@ -2,14 +2,23 @@
 
 #include "status.h"
 
+#include "components/cxmath.h"
 #include "components/latch.h"
 #include "components/phase-timer.h"
+#include "components/sample-rate.h"
+#include "signals/basic.h"
+
+#include <cmath>
 
 namespace dhe {
 namespace sequencizer {
 
 static auto constexpr pulse_duration = 9e-4F;
 
+// At audio rate, limits the work done in one sample when step durations are
+// tiny compared to the sample time.
+static auto constexpr max_transitions_per_sample = 64;
+
 template <typename Signals, typename StepSelector, typename StepController>
 class SequenceController {
 public:
@@ -18,16 +27,32 @@ public:
       : signals_{signals}, step_selector_{step_selector},
         step_controller_{step_controller} {}
 
+  // Precomputes the event pulses' phase increment per sample.
+  void on_sample_rate_change(float sample_time) {
+    pulse_delta_ = sample_time / pulse_duration;
+  }
+
   void execute(float sample_time) {
     // Process the latches even if not running. This ensures that we detect and
     // react to edges that happen on the same sample when RUN rises.
-    gate_latch_.clock(signals_.gate());
+    auto const gate_voltage = signals_.gate_voltage();
+    gate_latch_.clock(signals_.gate(),
+                      latch::edge_fraction(gate_voltage_, gate_voltage,
+                                           high_threshold));
+    gate_voltage_ = gate_voltage;
     reset_latch_.clock(signals_.is_reset());
-    show_events(sample_time);
+    show_events();
 
-    // Reset even if not running.
+    // Reset even if not running. If a position is available, reset moves the
+    // sequence to that position instead of idling, whether or not the sequence
+    // is running. This lets a transport cue a position while stopped, so that
+    // the sequence resumes from there when RUN rises.
     if (reset_latch_.is_rise()) {
-      become_idle();
+      if (signals_.has_position()) {
+        seek(signals_.position());
+      } else {
+        become_idle();
+      }
     }
 
     if (!signals_.is_running()) {
@@ -35,6 +60,9 @@ public:
     }
 
     if (step_ < 0) {
+      // If the gate starts the sequence, the first step generates only the
+      // portion of the sample that followed the gate edge.
+      sample_time *= gate_latch_.edge_fraction();
       idle();
     }
 
@@ -43,7 +71,66 @@ public:
     }
   }
 
+  /**
+   * Moves the sequence to the given position, where 0 is the start of the
+   * first selected step and 1 is the end of the last selected step. The
+   * position is weighted by the durations of the steps.
+   */
+  void seek(float position) { locate(position * sequence_duration()); }
+
+  /**
+   * Moves the sequence to the given number of seconds after the start of the
+   * first selected step. If the sequence is looping, offsets beyond the end of
+   * the sequence wrap around to its start.
+   */
+  void seek_time(float offset) {
+    if (signals_.is_looping()) {
+      auto const duration = sequence_duration();
+      if (duration > 0.F) {
+        offset = std::fmod(offset, duration);
+        if (offset < 0.F) {
+          offset += duration;
+        }
+      }
+    }
+    locate(offset);
+  }
+
 private:
+  auto sequence_duration() const -> float {
+    auto duration = 0.F;
+    for (auto step = first(); step >= 0; step = successor(step)) {
+      duration += signals_.duration(step);
+    }
+    return duration;
+  }
+
+  // Walks the selected steps, summing their durations until the sum passes the
+  // offset, then enters that step at the offset's phase within the step. An
+  // offset beyond the end of the sequence, or in a step with no duration,
+  // enters the step at phase 1.
+  void locate(float offset) {
+    if (step_ >= 0) {
+      step_controller_.exit();
+    }
+    auto step = first();
+    auto step_start = 0.F;
+    while (step >= 0) {
+      auto const duration = signals_.duration(step);
+      auto const step_end = step_start + duration;
+      auto const next_step = successor(step);
+      if (offset < step_end || next_step < 0) {
+        auto const phase =
+            duration > 0.F ? (offset - step_start) / duration : 1.F;
+        change_to_step(step, cx::clamp(phase, 0.F, 1.F));
+        return;
+      }
+      step_start = step_end;
+      step = next_step;
+    }
+    change_to_step(-1);
+  }
+
   void start_sequence() {
     start_of_sequence_.reset();
     change_to_step(first());
@@ -74,19 +161,45 @@ private:
     auto const status = step_controller_.execute(gate_latch_, sample_time);
     if (status == StepStatus::Idle) {
       advance_sequence();
+      if (signals_.is_audio_rate()) {
+        spend_leftover_time();
+      }
     } else {
       show_status(status);
     }
   }
 
+  // At audio rate, a step may end partway through a sample. Spend the rest of
+  // the sample in the steps that follow, which may also end within the sample.
+  void spend_leftover_time() {
+    // Any gate edge has already been handled during this sample.
+    gate_latch_.clock(gate_latch_.is_high());
+    for (auto i = 0; i < max_transitions_per_sample; i++) {
+      auto const leftover_time = step_controller_.leftover_time();
+      if (step_ < 0 || leftover_time <= 0.F) {
+        return;
+      }
+      auto const status = step_controller_.execute(gate_latch_, leftover_time);
+      if (status != StepStatus::Idle) {
+        show_status(status);
+        return;
+      }
+      advance_sequence();
+    }
+  }
+
   auto first() const -> int { return step_selector_.first(); }
 
-  auto successor() -> int { return step_selector_.successor(step_); }
+  auto successor() const -> int { return successor(step_); }
+
+  auto successor(int step) const -> int {
+    return step_selector_.successor(step);
+  }
 
-  void change_to_step(int step) {
+  void change_to_step(int step, float phase = 0.F) {
     step_ = step;
     if (step_ >= 0) {
-      step_controller_.enter(step_);
+      step_controller_.enter(step_, phase);
       show_status(StepStatus::Generating);
     } else {
       step_controller_.exit();
@@ -98,19 +211,20 @@ private:
     signals_.show_step_status(step_, status);
   }
 
-  void show_events(float sample_time) {
-    auto const pulse_delta = sample_time / pulse_duration;
-    start_of_sequence_.advance(pulse_delta);
+  void show_events() {
+    start_of_sequence_.advance(pulse_delta_);
     signals_.show_sequence_event(start_of_sequence_.in_progress());
-    end_of_step_.advance(pulse_delta);
+    end_of_step_.advance(pulse_delta_);
     signals_.show_step_event(end_of_step_.in_progress());
   }
 
   int step_{-1};
   Latch gate_latch_{};
+  float gate_voltage_{};
   Latch reset_latch_{};
   PhaseTimer start_of_sequence_{1.F};
   PhaseTimer end_of_step_{1.F};
+  float pulse_delta_{default_sample_time / pulse_duration};
   Signals &signals_;
   StepSelector &step_selector_;
   StepController &step_controller_;
@@ -7,6 +7,7 @@
 #include "trigger-mode.h"
 
 #include "components/range.h"
+#include "components/throttle.h"
 #include "signals/basic.h"
 #include "signals/duration-signals.h"
 #include "signals/shape-signals.h"
@@ -24,9 +25,14 @@ static auto constexpr brightness_skew = 0.7F;
 static auto constexpr brightness_range =
     Range{-brightness_skew, 1.F + brightness_skew};
 
+// At audio rate, steps may be much shorter than a sample.
+static auto constexpr audio_rate_min_duration = 1e-6F;
+
 template <typename TParam, typename TInput, typename TOutput, typename TLight,
           int N>
 struct Signals {
+  static auto constexpr step_count = N;
+
   Signals(std::vector<TInput> &inputs, std::vector<TParam> &params,
           std::vector<TOutput> &outputs, std::vector<TLight> &lights)
       : params_{params}, inputs_{inputs}, outputs_{outputs}, lights_{lights} {}
@@ -72,7 +78,10 @@ struct Signals {
         Gain::scale(rotation_of(params_[ParamId::DurationMultiplier],
                                 inputs_[InputId::DurationMultiplierCV]));
     auto const scaled_duration = nominal_duration * multiplier;
-    return cx::max(scaled_duration, ShortDuration::range.lower_bound());
+    auto const min_duration = is_audio_rate()
+                                  ? audio_rate_min_duration
+                                  : ShortDuration::range.lower_bound();
+    return cx::max(scaled_duration, min_duration);
   }
 
   auto gate() const -> bool {
@@ -80,6 +89,14 @@ struct Signals {
            is_pressed(params_[ParamId::Gate]);
   }
 
+  auto gate_voltage() const -> float {
+    return voltage_at(inputs_[InputId::Gate]);
+  }
+
+  auto has_position() const -> bool {
+    return inputs_[InputId::Position].isConnected();
+  }
+
   auto in_a() const -> float { return voltage_at(inputs_[InputId::InA]); }
 
   auto in_b() const -> float { return voltage_at(inputs_[InputId::InB]); }
@@ -90,6 +107,10 @@ struct Signals {
     return value_of<InterruptMode>(params_[ParamId::StepInterruptMode + step]);
   }
 
+  auto is_audio_rate() const -> bool {
+    return is_pressed(params_[ParamId::AudioRate]);
+  }
+
   auto is_enabled(int step) const -> bool {
     return is_pressed(params_[ParamId::StepEnabled + step]);
   }
@@ -112,6 +133,11 @@ struct Signals {
 
   void output(float voltage) { outputs_[OutputId::Out].setVoltage(voltage); }
 
+  auto position() const -> float {
+    auto const phase = voltage_at(inputs_[InputId::Position]) * 0.1F;
+    return cx::clamp(phase, 0.F, 1.F);
+  }
+
   auto selection_start() const -> int {
     return value_of<int>(params_[ParamId::SelectionStart]);
   }
@@ -128,9 +154,19 @@ struct Signals {
     outputs_[OutputId::IsCurving].setVoltage(curving ? 10.F : 0.F);
   }
 
+  void on_sample_rate_change(float sample_rate) {
+    light_throttle_.set_interval(light_update_interval_at(sample_rate));
+  }
+
   void show_inactive(int step) { set_lights(step, 0.F, 0.F); }
 
   void show_progress(int step, float progress) {
+    // Always show the start and end of a step. Between those, update the
+    // lights only as often as the UI can show them.
+    auto const is_boundary = progress <= 0.F || progress >= 1.F;
+    if (!light_throttle_.tick() && !is_boundary) {
+      return;
+    }
     auto const completed_brightness = brightness_range.scale(progress);
     auto const remaining_brightness = 1.F - completed_brightness;
     set_lights(step, completed_brightness, remaining_brightness);
@@ -181,6 +217,7 @@ private:
   std::vector<TInput> &inputs_;
   std::vector<TOutput> &outputs_;
   std::vector<TLight> &lights_;
+  Throttle light_throttle_{light_update_interval};
 };
 
 } // namespace sequencizer
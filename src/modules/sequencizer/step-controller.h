@@ -16,12 +16,13 @@ public:
       : interrupter_{interrupter}, generator_{generator}, sustainer_{
                                                               sustainer} {}
 
-  void enter(int step) {
+  void enter(int step, float phase = 0.F) {
     current_step_ = step;
-    generator_.start(step);
+    generator_.start(step, phase);
   }
 
   auto execute(Latch const &gate, float sample_time) -> StepStatus {
+    leftover_time_ = 0.F;
     if (!interrupted(gate)) {
       auto const generator_status = generator_.generate(sample_time);
       if (generator_status == GeneratorStatus::Generating) {
@@ -30,6 +31,7 @@ public:
       if (!sustainer_.is_done(current_step_, gate)) {
         return StepStatus::Sustaining;
       }
+      leftover_time_ = generator_.leftover_time();
     }
     exit();
     return StepStatus::Idle;
@@ -37,12 +39,17 @@ public:
 
   void exit() { generator_.stop(); }
 
+  // The portion of the most recently executed sample that remained after the
+  // step completed. An interrupted step leaves no time.
+  auto leftover_time() const -> float { return leftover_time_; }
+
 private:
   auto interrupted(Latch const &gate) const -> bool {
     return interrupter_.is_interrupted(current_step_, gate);
   };
 
   int current_step_{0};
+  float leftover_time_{0.F};
   Interrupter &interrupter_;
   Generator &generator_;
   Sustainer &sustainer_;
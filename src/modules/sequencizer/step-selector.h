@@ -1,40 +1,63 @@
 #pragma once
 
+#include <vector>
+
 namespace dhe {
 namespace sequencizer {
 template <typename Signals> class StepSelector {
 public:
   StepSelector(Signals &signals, int step_count)
-      : signals_{signals}, step_mask_{step_count - 1} {}
+      : signals_{signals}, step_mask_{step_count - 1},
+        step_count_{step_count}, successors_(step_count, -1) {}
 
-  auto first() const -> int {
+  // Reads the selection and the enabled steps, and recomputes each step's
+  // successor if any of them changed. Call once per sample, so that at audio
+  // rate each step transition within the sample is a table lookup.
+  void refresh() {
     auto const selection_start = signals_.selection_start();
-    if (is_enabled(selection_start)) {
-      return selection_start;
+    auto const selection_length = signals_.selection_length();
+    auto enabled = 0U;
+    for (auto step = 0; step < step_count_; step++) {
+      if (signals_.is_enabled(step)) {
+        enabled |= 1U << step;
+      }
+    }
+    if (selection_start == selection_start_ &&
+        selection_length == selection_length_ && enabled == enabled_) {
+      return;
     }
-    return successor(selection_start, selection_start,
-                     signals_.selection_length());
+    selection_start_ = selection_start;
+    selection_length_ = selection_length;
+    enabled_ = enabled;
+    for (auto step = 0; step < step_count_; step++) {
+      successors_[step] = find_successor(step);
+    }
+    first_ = is_enabled(selection_start_)
+                 ? selection_start_
+                 : successors_[static_cast<size_t>(selection_start_)];
   }
 
+  auto first() const -> int { return first_; }
+
   auto successor(int current) const -> int {
-    return successor(current, signals_.selection_start(),
-                     signals_.selection_length());
+    return successors_[static_cast<size_t>(current)];
   }
 
 private:
-  auto is_enabled(int step) const -> bool { return signals_.is_enabled(step); }
+  auto is_enabled(int step) const -> bool {
+    return (enabled_ & (1U << step)) != 0U;
+  }
 
-  auto successor(int current, int selection_start, int selection_length) const
-      -> int {
+  auto find_successor(int current) const -> int {
     auto const selection_end =
-        (selection_start + selection_length - 1) & step_mask_;
+        (selection_start_ + selection_length_ - 1) & step_mask_;
     if (current == selection_end ||
-        !is_selected(current, selection_start, selection_end)) {
+        !is_selected(current, selection_start_, selection_end)) {
       return -1;
     }
-    for (auto i = current + 1; i < selection_start + selection_length; i++) {
+    for (auto i = current + 1; i < selection_start_ + selection_length_; i++) {
       auto const candidate = i & step_mask_;
-      if (is_selected(candidate, selection_start, selection_end) &&
+      if (is_selected(candidate, selection_start_, selection_end) &&
           is_enabled(candidate)) {
         return candidate;
       }
@@ -53,6 +76,12 @@ private:
 
   Signals &signals_;
   int const step_mask_;
+  int const step_count_;
+  int selection_start_{-1};
+  int selection_length_{-1};
+  unsigned int enabled_{};
+  int first_{-1};
+  std::vector<int> successors_;
 };
 } // namespace sequencizer
 } // namespace dhe
@@ -45,5 +45,40 @@ static inline auto is_satisfied(GateMode condition, dhe::Latch const &gate)
   }
 }
 
+/**
+ * Latches the gates of many channels at once. Bit c of each mask is the
+ * state of channel c.
+ */
+class ChannelLatches {
+public:
+  void clock(unsigned int high_channels) {
+    edges_ = high_channels ^ highs_;
+    highs_ = high_channels;
+  }
+
+  /**
+   * Reports which channels satisfy the condition.
+   */
+  auto satisfying(GateMode condition) const -> unsigned int {
+    switch (condition) {
+    case GateMode::High:
+    default:
+      return highs_;
+    case GateMode::Rise:
+      return edges_ & highs_;
+    case GateMode::Fall:
+      return edges_ & ~highs_;
+    case GateMode::Edge:
+      return edges_;
+    case GateMode::Low:
+      return ~highs_;
+    }
+  }
+
+private:
+  unsigned int highs_{};
+  unsigned int edges_{};
+};
+
 } // namespace truth
 } // namespace dhe
@@ -10,6 +10,8 @@ void init(rack::plugin::Plugin *plugin) {
   plugin->addModel(rack::createModel<Module<2>, Panel<Truth2>>("Truth2"));
   plugin->addModel(rack::createModel<Module<3>, Panel<Truth3>>("Truth3"));
   plugin->addModel(rack::createModel<Module<4>, Panel<Truth4>>("Truth4"));
+  plugin->addModel(rack::createModel<Module<5>, GridPanel<Truth5>>("Truth5"));
+  plugin->addModel(rack::createModel<Module<6>, GridPanel<Truth6>>("Truth6"));
 }
 } // namespace truth
 } // namespace dhe
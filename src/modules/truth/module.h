@@ -8,10 +8,14 @@
 #include "outcome.h"
 #include "params/presets.h"
 #include "signals/basic.h"
+#include "truth-table.h"
 #include "upgrader.h"
 
 #include "rack.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -20,10 +24,43 @@ namespace dhe {
 namespace truth {
 auto constexpr version = 1;
 
+// An outcome switch that tells its module when the user changes its outcome,
+// so that the module recompiles its truth table only after a change.
+struct OutcomeSwitch {
+  struct Quantity : rack::engine::SwitchQuantity {
+    void setValue(float value) override {
+      rack::engine::SwitchQuantity::setValue(value);
+      *outcomes_changed_ = true;
+    }
+
+    void notify(std::atomic<bool> *outcomes_changed) {
+      outcomes_changed_ = outcomes_changed;
+    }
+
+  private:
+    std::atomic<bool> *outcomes_changed_{};
+  };
+
+  static inline auto config(rack::engine::Module *module, int id,
+                            std::atomic<bool> *outcomes_changed)
+      -> Quantity * {
+    static auto const labels = std::vector<std::string>{
+        outcome::names.cbegin(), outcome::names.cend()};
+    static auto const max_value = static_cast<float>(labels.size() - 1);
+    auto const default_value = static_cast<float>(Outcome::True);
+    auto *q = module->configSwitch<Quantity>(id, 0.F, max_value, default_value,
+                                             "Q", labels);
+    q->notify(outcomes_changed);
+    return q;
+  }
+};
+
 template <int N> struct Module : rack::engine::Module {
+  using float_4 = rack::simd::float_4;
+
   Module() {
     static auto const input_names =
-        std::vector<std::string>{"A", "B", "C", "D"};
+        std::vector<std::string>{"A", "B", "C", "D", "E", "F"};
 
     config(ParamId::Count, InputId::Count, OutputId::Count);
 
@@ -40,8 +77,7 @@ template <int N> struct Module : rack::engine::Module {
                               GateMode::High);
     static auto constexpr rows = 1 << N;
     for (int row = 0; row < rows; row++) {
-      Switch::config<Outcomes>(this, ParamId::Outcome + row, "Q",
-                               Outcome::True);
+      OutcomeSwitch::config(this, ParamId::Outcome + row, &outcomes_changed_);
     }
     Button::config(this, ParamId::ForcQHigh, "Q");
     configOutput(OutputId::Q, "Q");
@@ -50,10 +86,39 @@ template <int N> struct Module : rack::engine::Module {
   }
 
   void process(ProcessArgs const & /*ignored*/) override {
-    gate_.clock(is_true(N - 1));
-    auto const q = outcome() ? 10.F : 0.F;
-    outputs[OutputId::Q].setVoltage(q);
-    outputs[OutputId::QNot].setVoltage(10.F - q);
+    if (outcomes_changed_.exchange(false)) {
+      compile_outcomes();
+    } else {
+      audit_outcome();
+    }
+    auto channels = 1;
+    for (int i = 0; i < N; i++) {
+      channels = std::max(channels, inputs[InputId::Input + i].getChannels());
+    }
+    auto const all_channels = (1U << channels) - 1U;
+
+    // Bit c of each mask is the state of channel c.
+    auto input_channels = std::array<unsigned int, N>{};
+    for (int i = 0; i < N; i++) {
+      auto const forced = is_pressed(params[ParamId::ForceInputHigh + i]);
+      input_channels[i] =
+          high_channels(inputs[InputId::Input + i], channels) |
+          (forced ? all_channels : 0U);
+    }
+    gates_.clock(input_channels[N - 1]);
+    q_channels_ = outcomes(input_channels) & all_channels;
+
+    auto &q_output = outputs[OutputId::Q];
+    auto &q_not_output = outputs[OutputId::QNot];
+    q_output.setChannels(channels);
+    q_not_output.setChannels(channels);
+    for (auto c = 0; c < channels; c += 4) {
+      auto const lane_highs = static_cast<int>((q_channels_ >> c) & 0xFU);
+      auto const highs = rack::simd::movemaskInverse<float_4>(lane_highs);
+      auto const q = rack::simd::ifelse(highs, 10.F, 0.F);
+      q_output.setVoltageSimd(q, c);
+      q_not_output.setVoltageSimd(10.F - q, c);
+    }
   }
 
   void dataFromJson(json_t *data) override {
@@ -62,6 +127,19 @@ template <int N> struct Module : rack::engine::Module {
     if (preset_version != version) {
       upgrade::from_v0<N>(params);
     }
+    outcomes_changed_ = true;
+  }
+
+  // Resetting and randomizing set the params without their quantities'
+  // setValue(), so recompile the table afterward.
+  void onReset(ResetEvent const &e) override {
+    rack::engine::Module::onReset(e);
+    outcomes_changed_ = true;
+  }
+
+  void onRandomize(RandomizeEvent const &e) override {
+    rack::engine::Module::onRandomize(e);
+    outcomes_changed_ = true;
   }
 
   auto dataToJson() -> json_t * override {
@@ -71,52 +149,63 @@ template <int N> struct Module : rack::engine::Module {
   }
 
 private:
-  auto outcome() -> bool {
+  auto outcomes(std::array<unsigned int, N> const &input_channels) const
+      -> unsigned int {
     if (is_pressed(params[ParamId::ForcQHigh])) {
-      return true;
+      return ~0U;
     }
     if (is_pressed(params[ParamId::ForceQNotHigh])) {
-      return false;
+      return 0U;
     }
-    return outcome_for(selection());
+    auto const gate_mode =
+        static_cast<GateMode>(value_of(params[ParamId::GateMode]));
+    return table_.outcomes(input_channels, gates_.satisfying(gate_mode),
+                           q_channels_);
   }
 
-  auto outcome_for(int row) const -> bool {
-    auto const outcome =
-        static_cast<Outcome>(value_of(params[ParamId::Outcome + row]));
-    switch (outcome) {
-    default:
-      return false;
-    case Outcome::True:
-      return true;
-    case Outcome::Q:
-      return is_high(outputs[OutputId::Q]);
-    case Outcome::QNot:
-      return is_high(outputs[OutputId::QNot]);
+  auto high_channels(rack::engine::Input &input, int channels) const
+      -> unsigned int {
+    auto highs = 0U;
+    for (auto c = 0; c < channels; c += 4) {
+      auto const voltages = input.getPolyVoltageSimd<float_4>(c);
+      auto const lane_highs = rack::simd::movemask(voltages > high_threshold);
+      highs |= static_cast<unsigned int>(lane_highs) << c;
     }
+    return highs;
   }
 
-  auto selection() const -> int {
-    auto input_state = 0;
-    for (int i = 0; i < N - 1; i++) {
-      input_state += input_state + (is_true(i) ? 1 : 0);
+  void compile_outcomes() {
+    for (auto row = 0; row < TruthTable<N>::rows; row++) {
+      compile_outcome(row);
     }
-    input_state += input_state + (is_satisfied(gate_mode(), gate_) ? 1 : 0);
-    return input_state;
   }
 
-  auto is_true(int i) const -> bool {
-    return is_high(inputs[InputId::Input + i]) ||
-           is_pressed(params[ParamId::ForceInputHigh + i]);
+  // Undo writes an outcome param without its quantity's setValue(), so check
+  // one row per sample for an outcome that changed without notice.
+  void audit_outcome() {
+    auto const row = audited_row_;
+    audited_row_ = (row + 1) % TruthTable<N>::rows;
+    if (value_of(params[ParamId::Outcome + row]) != outcome_values_[row]) {
+      compile_outcome(row);
+    }
   }
 
-  auto gate_mode() const -> GateMode {
-    return static_cast<GateMode>(value_of(params[ParamId::GateMode]));
+  void compile_outcome(int row) {
+    auto const value = value_of(params[ParamId::Outcome + row]);
+    outcome_values_[row] = value;
+    table_.set(row, static_cast<Outcome>(value));
   }
 
   using ParamId = ParamIds<N>;
   using InputId = InputIds<N>;
-  dhe::Latch gate_{};
+  ChannelLatches gates_{};
+  unsigned int q_channels_{};
+  TruthTable<N> table_{};
+  // Set when an outcome changes, and initially, so that the table is compiled
+  // on the first sample.
+  std::atomic<bool> outcomes_changed_{true};
+  std::array<float, TruthTable<N>::rows> outcome_values_{};
+  int audited_row_{};
 };
 } // namespace truth
 } // namespace dhe
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "outcome.h"
+
+#include "panels/assets.h"
+
+#include "rack.hpp"
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace dhe {
+namespace truth {
+
+/**
+ * Edits all of a truth table's outcomes in one compact grid, for tables with
+ * too many rows for a column of steppers. The first inputs select the grid
+ * row and the remaining inputs select the grid column, so cell (r, c) holds
+ * the outcome of table row r * columns + c. Clicking a cell steps its outcome
+ * to the next value.
+ */
+template <typename Panel, int N>
+struct OutcomeGrid : public rack::widget::OpaqueWidget {
+  static auto constexpr row_bits = (N + 1) / 2;
+  static auto constexpr column_bits = N - row_bits;
+  static auto constexpr rows = 1 << row_bits;
+  static auto constexpr columns = 1 << column_bits;
+
+  OutcomeGrid(rack::engine::Module *module, int first_outcome_id,
+              float cell_size)
+      : module_{module}, first_outcome_id_{first_outcome_id},
+        cell_size_{cell_size} {
+    auto const prefix = std::string{Panel::svg_dir} + "/outcome-cell-";
+    for (auto i = 0U; i < frames_.size(); i++) {
+      frames_[i] = load_svg(prefix + std::to_string(i + 1));
+    }
+    box.size = rack::math::Vec{cell_size * columns, cell_size * rows};
+  }
+
+  template <typename P>
+  static inline void install(P *panel, int first_outcome_id, float left_mm,
+                             float top_mm, float cell_size_mm) {
+    auto *grid = new OutcomeGrid{panel->getModule(), first_outcome_id,
+                                 mm2px(cell_size_mm)};
+    grid->box.pos = mm2px(left_mm, top_mm);
+    panel->addChild(grid);
+  }
+
+  void draw(DrawArgs const &args) override {
+    for (auto row = 0; row < rows; row++) {
+      for (auto column = 0; column < columns; column++) {
+        auto const &frame = frames_[outcome_index(row * columns + column)];
+        if (!frame || frame->handle == nullptr) {
+          continue;
+        }
+        auto const frame_size = frame->getSize();
+        auto const x = (static_cast<float>(column) + 0.5F) * cell_size_;
+        auto const y = (static_cast<float>(row) + 0.5F) * cell_size_;
+        nvgSave(args.vg);
+        nvgTranslate(args.vg, x - frame_size.x / 2.F, y - frame_size.y / 2.F);
+        rack::window::svgDraw(args.vg, frame->handle);
+        nvgRestore(args.vg);
+      }
+    }
+    OpaqueWidget::draw(args);
+  }
+
+  void onButton(ButtonEvent const &e) override {
+    if (module_ == nullptr || e.action != GLFW_PRESS ||
+        e.button != GLFW_MOUSE_BUTTON_LEFT) {
+      OpaqueWidget::onButton(e);
+      return;
+    }
+    auto const column = static_cast<int>(e.pos.x / cell_size_);
+    auto const row = static_cast<int>(e.pos.y / cell_size_);
+    if (column < 0 || column >= columns || row < 0 || row >= rows) {
+      return;
+    }
+    auto const param_id = first_outcome_id_ + row * columns + column;
+    auto *const quantity = module_->getParamQuantity(param_id);
+    auto const old_value = quantity->getValue();
+    auto const new_value =
+        static_cast<float>((static_cast<int>(old_value) + 1) % outcome::size);
+    quantity->setValue(new_value);
+
+    auto *change = new rack::history::ParamChange;
+    change->name = "change outcome";
+    change->moduleId = module_->id;
+    change->paramId = param_id;
+    change->oldValue = old_value;
+    change->newValue = new_value;
+    APP->history->push(change);
+    e.consume(this);
+  }
+
+private:
+  auto outcome_index(int table_row) const -> int {
+    if (module_ == nullptr) {
+      return static_cast<int>(Outcome::True);
+    }
+    auto const value =
+        module_->params[first_outcome_id_ + table_row].getValue();
+    return static_cast<int>(value);
+  }
+
+  rack::engine::Module *module_;
+  int first_outcome_id_;
+  float cell_size_;
+  std::array<std::shared_ptr<rack::window::Svg>, outcome::size> frames_{};
+};
+} // namespace truth
+} // namespace dhe
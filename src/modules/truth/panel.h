@@ -2,6 +2,7 @@
 
 #include "control-ids.h"
 #include "gate-mode.h"
+#include "outcome-grid.h"
 #include "outcome.h"
 
 #include "controls/buttons.h"
@@ -107,5 +108,71 @@ template <typename TLayout> struct Panel : public PanelWidget<Panel<TLayout>> {
                      TLayout::output_top + TLayout::port_dy);
   }
 };
+
+// Truth 5 and Truth 6 edit their outcomes in a grid. Rows select the first
+// half of the inputs, and columns select the rest.
+template <int N> struct TruthGrid {
+  static auto constexpr hp = 18;
+  static auto constexpr input_count = N;
+  static auto constexpr columns = 1 << (N - (N + 1) / 2);
+
+  static auto constexpr cell_size = hp2mm(1.F);
+  static auto constexpr grid_left = hp2mm(8.F);
+  static auto constexpr grid_top = 40.F;
+  static auto constexpr input_x = hp2mm(2.F);
+  static auto constexpr input_top = 29.36F;
+  static auto constexpr port_dy = 14.585F;
+  static auto constexpr output_y = input_top + 5.F * port_dy;
+  static auto constexpr q_x = hp2mm(12.F);
+  static auto constexpr q_not_x = hp2mm(16.F);
+  static auto constexpr gate_mode_x =
+      grid_left + static_cast<float>(columns + 1) * cell_size;
+  static auto constexpr gate_mode_y = grid_top - cell_size / 2.F;
+};
+
+struct Truth5 : TruthGrid<5> {
+  static auto constexpr panel_file = "truth-5";
+};
+
+struct Truth6 : TruthGrid<6> {
+  static auto constexpr panel_file = "truth-6";
+};
+
+template <typename TLayout>
+struct GridPanel : public PanelWidget<GridPanel<TLayout>> {
+  static auto constexpr hp = TLayout::hp;
+  static auto constexpr panel_file = TLayout::panel_file;
+  static auto constexpr svg_dir = "truth";
+
+  explicit GridPanel(rack::engine::Module *module)
+      : PanelWidget<GridPanel<TLayout>>{module} {
+    static auto constexpr input_count = TLayout::input_count;
+    using ParamId = ParamIds<input_count>;
+    using InputId = InputIds<input_count>;
+
+    for (int i = 0; i < input_count; i++) {
+      auto const y =
+          TLayout::input_top + static_cast<float>(i) * TLayout::port_dy;
+      InPort::install(this, InputId::Input + i, TLayout::input_x, y);
+      Button::install<Momentary>(this, ParamId::ForceInputHigh + i,
+                                 TLayout::input_x + button_port_distance, y);
+    }
+
+    Stepper::install<GateModes>(this, ParamId::GateMode, TLayout::gate_mode_x,
+                                TLayout::gate_mode_y);
+    OutcomeGrid<GridPanel, input_count>::install(
+        this, ParamId::Outcome, TLayout::grid_left, TLayout::grid_top,
+        TLayout::cell_size);
+
+    Button::install<Momentary, Reversed>(this, ParamId::ForcQHigh,
+                                         TLayout::q_x - button_port_distance,
+                                         TLayout::output_y);
+    OutPort::install(this, OutputId::Q, TLayout::q_x, TLayout::output_y);
+    Button::install<Momentary, Reversed>(
+        this, ParamId::ForceQNotHigh, TLayout::q_not_x - button_port_distance,
+        TLayout::output_y);
+    OutPort::install(this, OutputId::QNot, TLayout::q_not_x, TLayout::output_y);
+  }
+};
 } // namespace truth
 } // namespace dhe
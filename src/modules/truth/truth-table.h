@@ -0,0 +1,99 @@
+#pragma once
+
+#include "outcome.h"
+
+#include <array>
+#include <cstdint>
+
+namespace dhe {
+namespace truth {
+
+/**
+ * The outcomes of a truth table's rows, compiled into one bitmask per kind of
+ * outcome, so that evaluating a row is a shift and a mask. Row r's outcome is
+ * recorded in bit r of the mask for that outcome. A False row is absent from
+ * every mask.
+ */
+template <int N> class TruthTable {
+public:
+  static auto constexpr rows = 1 << N;
+
+  void set(int row, Outcome outcome) {
+    auto const bit = Mask{1} << row;
+    true_rows_ &= ~bit;
+    q_rows_ &= ~bit;
+    q_not_rows_ &= ~bit;
+    switch (outcome) {
+    case Outcome::True:
+      true_rows_ |= bit;
+      break;
+    case Outcome::Q:
+      q_rows_ |= bit;
+      break;
+    case Outcome::QNot:
+      q_not_rows_ |= bit;
+      break;
+    case Outcome::False:
+    default:
+      break;
+    }
+  }
+
+  /**
+   * Reports the outcome of the given row, given the current state of Q.
+   */
+  auto outcome(int row, bool q) const -> bool {
+    auto const rows_true_now = true_rows_ | (q ? q_rows_ : q_not_rows_);
+    return ((rows_true_now >> row) & Mask{1}) != 0;
+  }
+
+  /**
+   * Reports the outcomes of many channels at once. Bit c of each mask is
+   * the state of channel c: of each input, of the gate condition, and of Q.
+   * The gate condition selects the row in place of the last input, whose
+   * mask is ignored.
+   *
+   * Each row's outcome is a mask of the channels for which the row is true:
+   * every channel, no channel, the channels whose Q is high, or those whose Q
+   * is low. A tree of word-wide multiplexers then selects, for every channel
+   * at once, the outcome of the row that the channel's inputs select. Each
+   * level of the tree halves the candidate rows by one bit of the row number,
+   * from the condition (the lowest bit) to the first input (the highest).
+   */
+  auto outcomes(std::array<unsigned int, N> const &input_channels,
+                unsigned int condition_channels, unsigned int q_channels) const
+      -> unsigned int {
+    auto candidates = std::array<unsigned int, rows>{};
+    for (auto row = 0; row < rows; row++) {
+      candidates[row] = channels_if(true_rows_, row) |
+                        (channels_if(q_rows_, row) & q_channels) |
+                        (channels_if(q_not_rows_, row) & ~q_channels);
+    }
+    auto count = rows;
+    for (auto bit = 0; bit < N; bit++) {
+      auto const high =
+          bit == 0 ? condition_channels : input_channels[N - 1 - bit];
+      count /= 2;
+      for (auto row = 0; row < count; row++) {
+        candidates[row] = (high & candidates[2 * row + 1]) |
+                          (~high & candidates[2 * row]);
+      }
+    }
+    return candidates[0];
+  }
+
+private:
+  using Mask = std::uint64_t;
+  static_assert(rows <= 64, "Each outcome mask holds at most 64 rows");
+
+  // Every channel if the row is in the mask, and otherwise no channel.
+  static auto channels_if(Mask mask, int row) -> unsigned int {
+    return 0U - static_cast<unsigned int>((mask >> row) & Mask{1});
+  }
+
+  Mask true_rows_{};
+  Mask q_rows_{};
+  Mask q_not_rows_{};
+};
+} // namespace truth
+} // namespace dhe
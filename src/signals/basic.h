@@ -2,6 +2,9 @@
 
 #include "linear-signals.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace dhe {
 template <typename V = float, typename P> auto value_of(P const &param) -> V {
   return static_cast<V>(const_cast<P &>(param).getValue());
@@ -11,16 +14,58 @@ template <typename I> auto voltage_at(I const &input) -> float {
   return const_cast<I &>(input).getVoltage();
 }
 
+/**
+ * The voltages of the channels that start at the given channel, one per lane
+ * of a SIMD vector T (such as rack::simd::float_4). A monophonic input's
+ * voltage appears in every lane.
+ */
+template <typename T, typename I>
+auto voltages_at(I const &input, int channel) -> T {
+  return const_cast<I &>(input).template getPolyVoltageSimd<T>(channel);
+}
+
+/**
+ * The number of channels a polyphonic module must process: the largest
+ * channel count among its inputs, and at least one.
+ */
+template <typename I>
+auto channel_count(std::vector<I> const &inputs) -> int {
+  auto channels = 1;
+  for (auto const &input : inputs) {
+    channels = std::max(channels, const_cast<I &>(input).getChannels());
+  }
+  return channels;
+}
+
 template <typename P> auto is_pressed(P const &param) -> bool {
   return value_of<bool>(param);
 }
 
+static auto constexpr high_threshold = 1.F;
+
 template <typename I> auto is_high(I const &input) -> bool {
-  return voltage_at(input) > 1.F;
+  return voltage_at(input) > high_threshold;
+}
+
+// A lane mask of the channels whose voltages are high.
+template <typename T, typename I>
+auto highs_at(I const &input, int channel) -> T {
+  return voltages_at<T>(input, channel) > high_threshold;
 }
 
+// A lane mask with every lane in the given state.
+template <typename T> auto lane_mask(bool state) -> T {
+  return state ? T::mask() : T{0.F};
+}
+
+// The gate voltage of each lane of a lane mask: 10V if set, otherwise 0V.
+template <typename T> auto gate_voltages(T mask) -> T {
+  return ifelse(mask, T{10.F}, T{0.F});
+}
+
+static auto constexpr rotation_per_volt = 0.1F;
+
 template <typename I> auto modulation_of(I const &cv_input) -> float {
-  static auto constexpr rotation_per_volt = 0.1F;
   return voltage_at(cv_input) * rotation_per_volt;
 }
 
@@ -38,6 +83,12 @@ auto rotation_of(P const &knob, I const &cv_input) -> float {
   return value_of(knob) + modulation_of(cv_input);
 }
 
+// The rotation of a knob modulated by each channel of a CV input.
+template <typename T, typename P, typename I>
+auto rotations_of(P const &knob, I const &cv_input, int channel) -> T {
+  return value_of(knob) + voltages_at<T>(cv_input, channel) * rotation_per_volt;
+}
+
 template <typename P, typename I>
 auto rotation_of(P const &knob, I const &cv_input, P const &av_knob) -> float {
   return value_of(knob) + modulation_of(cv_input, av_knob);
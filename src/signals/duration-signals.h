@@ -6,13 +6,18 @@
 #include <array>
 
 namespace dhe {
-enum class DurationRangeId { Short, Medium, Long };
+enum class DurationRangeId { Short, Medium, Long, Micro };
 
 namespace duration {
 static auto constexpr short_range = Range{0.001F, 1.F};
 static auto constexpr medium_range = Range{0.01F, 10.F};
 static auto constexpr long_range = Range{0.1F, 100.F};
 
+// For audio rate stages, as short as a few samples. Chosen by a menu option,
+// rather than by a duration range switch.
+static auto constexpr micro_range = Range{0.0001F, 0.1F};
+static auto constexpr micro_label = "0.0001–0.1 s";
+
 /*
  * Each duration range is of the form [n, 1000n]. Given ranges of that form,
  * this curvature tapers the rotation so a knob positioned dead center yields
@@ -25,6 +30,10 @@ static constexpr auto scale(float rotation, Range range) -> float {
   return range.scale(JShape::apply(rotation, taper_curvature));
 }
 
+template <typename T> static inline auto scale(T rotation, Range range) -> T {
+  return range.scale(JShape::apply(rotation, T{taper_curvature}));
+}
+
 static constexpr auto normalize(float seconds, Range range) -> float {
   return JShape::invert(range.normalize(seconds), taper_curvature);
 }
@@ -61,11 +70,15 @@ struct LongDuration : duration::Tapered<LongDuration> {
 
 struct Duration {
   static inline auto label(DurationRangeId id) -> char const * {
-    return duration::labels[static_cast<size_t>(id)];
+    return id == DurationRangeId::Micro
+               ? duration::micro_label
+               : duration::labels[static_cast<size_t>(id)];
   }
 
   static inline auto range(DurationRangeId id) -> Range {
-    return duration::ranges[static_cast<size_t>(id)];
+    return id == DurationRangeId::Micro
+               ? duration::micro_range
+               : duration::ranges[static_cast<size_t>(id)];
   }
 
   static inline auto scale(float normalized, DurationRangeId range_id)
@@ -23,6 +23,10 @@ struct JShape {
   static constexpr auto invert(float input, float curvature) -> float {
     return sigmoid::curve(input, -curvature);
   }
+
+  template <typename T> static inline auto apply(T input, T curvature) -> T {
+    return sigmoid::curve(input, curvature);
+  }
 };
 
 struct SShape {
@@ -34,6 +38,10 @@ struct SShape {
     return apply(input, -curvature);
   }
 
+  template <typename T> static inline auto apply(T input, T curvature) -> T {
+    return (sigmoid::curve(input * 2.F - 1.F, -curvature) + 1.F) * 0.5F;
+  }
+
 private:
   static constexpr auto scale_up(float input) -> float {
     return cx::scale(input, -1.F, 1.F);
@@ -69,6 +77,10 @@ struct Curvature {
   static constexpr auto normalize(float scaled) -> float {
     return SShape::invert(range.normalize(scaled), taper_curvature);
   }
+
+  template <typename T> static inline auto scale(T normalized) -> T {
+    return range.scale(SShape::apply(normalized, T{taper_curvature}));
+  }
 };
 
 } // namespace dhe
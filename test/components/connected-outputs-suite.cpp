@@ -0,0 +1,95 @@
+#include "components/connected-outputs.h"
+
+#include "dheunit/test.h"
+
+#include <array>
+
+namespace dhe {
+namespace components {
+namespace test {
+using dhe::ConnectedOutputs;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+
+struct Output {
+  auto isConnected() const -> bool { return connected_; } // NOLINT
+  bool connected_{};                                      // NOLINT
+};
+
+struct Writer {
+  int output_id_; // NOLINT
+};
+
+static auto constexpr output_count = 4;
+using Outputs = std::array<Output, output_count>;
+using Writers = std::array<Writer, output_count>;
+
+static auto const writers = Writers{Writer{3}, Writer{2}, Writer{1}, Writer{0}};
+
+class ConnectedOutputsSuite : public Suite {
+public:
+  ConnectedOutputsSuite() : Suite{"dhe::ConnectedOutputs"} {}
+
+  void run(Tester &t) override {
+    t.run("keeps the writers of connected outputs, in order", [](Tester &t) {
+      auto outputs = Outputs{};
+      outputs[0].connected_ = true;
+      outputs[2].connected_ = true;
+      auto connected = ConnectedOutputs<Writer, output_count>{};
+
+      connected.update(outputs, writers);
+
+      if (connected.size() != 2) {
+        t.fatalf("Got {} writers, want 2", connected.size());
+      }
+      if (connected.begin()[0].output_id_ != 2) {
+        t.errorf("First writer writes {}, want 2",
+                 connected.begin()[0].output_id_);
+      }
+      if (connected.begin()[1].output_id_ != 0) {
+        t.errorf("Second writer writes {}, want 0",
+                 connected.begin()[1].output_id_);
+      }
+    });
+
+    t.run("rebuilds only after it is invalidated", [](Tester &t) {
+      auto outputs = Outputs{};
+      auto connected = ConnectedOutputs<Writer, output_count>{};
+      connected.update(outputs, writers);
+
+      outputs[1].connected_ = true;
+      connected.update(outputs, writers);
+      if (connected.size() != 0) {
+        t.errorf("Got {} writers before invalidating, want 0",
+                 connected.size());
+      }
+
+      connected.invalidate();
+      connected.update(outputs, writers);
+      if (connected.size() != 1) {
+        t.errorf("Got {} writers after invalidating, want 1",
+                 connected.size());
+      }
+    });
+
+    t.run("contains the ids of connected outputs", [](Tester &t) {
+      auto outputs = Outputs{};
+      outputs[3].connected_ = true;
+      auto connected = ConnectedOutputs<Writer, output_count>{};
+
+      connected.update(outputs, writers);
+
+      for (auto id = 0; id < output_count; id++) {
+        if (connected.contains(id) != (id == 3)) {
+          t.errorf("contains({}) returned {}, want {}", id,
+                   connected.contains(id), id == 3);
+        }
+      }
+    });
+  }
+};
+
+static auto _ = ConnectedOutputsSuite{};
+} // namespace test
+} // namespace components
+} // namespace dhe
@@ -22,6 +22,10 @@ using TestFunc = std::function<void(Tester &)>;
 static auto require_equal(const Latch &a, const Latch &b) -> TestFunc;
 static auto require_unequal(const Latch &a, const Latch &b) -> TestFunc;
 static auto check_clock(Latch l, bool signal, Latch want_latch) -> TestFunc;
+static auto check_edge_fraction(Latch l, bool signal, float edge_fraction,
+                                float want) -> TestFunc;
+static auto check_crossing(float previous, float current, float want)
+    -> TestFunc;
 
 class LatchSuite : public Suite {
 public:
@@ -59,6 +63,22 @@ public:
     t.run("falling + high signal → rises", check_clock(falling, true, rising));
     t.run("falling + low signal → loses edge",
           check_clock(falling, false, low));
+
+    t.run("rise retains edge fraction",
+          check_edge_fraction(low, true, 0.25F, 0.25F));
+    t.run("fall retains edge fraction",
+          check_edge_fraction(high, false, 0.75F, 0.75F));
+    t.run("non-edge discards edge fraction",
+          check_edge_fraction(high, true, 0.25F, 1.F));
+
+    t.run("crossing halfway through rise → 0.5",
+          check_crossing(0.F, 2.F, 0.5F));
+    t.run("crossing early in rise → 0.75", check_crossing(0.F, 4.F, 0.75F));
+    t.run("crossing late in rise → 0.25", check_crossing(-2.F, 2.F, 0.25F));
+    t.run("crossing halfway through fall → 0.5",
+          check_crossing(2.F, 0.F, 0.5F));
+    t.run("no crossing while low → 1", check_crossing(0.F, 0.5F, 1.F));
+    t.run("no crossing while high → 1", check_crossing(2.F, 3.F, 1.F));
   }
 };
 
@@ -74,6 +94,28 @@ auto check_clock(Latch l, bool signal, Latch want_latch) -> TestFunc {
   };
 }
 
+auto check_edge_fraction(Latch l, bool signal, float edge_fraction, float want)
+    -> TestFunc {
+  return [l, signal, edge_fraction, want](Tester &t) mutable {
+    l.clock(signal, edge_fraction);
+
+    if (l.edge_fraction() != want) {
+      t.errorf("Got edge fraction {}, want {}", l.edge_fraction(), want);
+    }
+  };
+}
+
+auto check_crossing(float previous, float current, float want) -> TestFunc {
+  return [previous, current, want](Tester &t) {
+    static auto constexpr threshold = 1.F;
+    auto const got = latch::edge_fraction(previous, current, threshold);
+
+    if (got != want) {
+      t.errorf("Got {}, want {}", got, want);
+    }
+  };
+}
+
 auto require_unequal(const Latch &a, const Latch &b) -> TestFunc {
   return [a, b](Tester &t) {
     if (a == b) {
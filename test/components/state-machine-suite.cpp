@@ -0,0 +1,103 @@
+#include "components/state-machine.h"
+
+#include "dheunit/test.h"
+
+#include <string>
+
+namespace dhe {
+namespace components {
+namespace test {
+using dhe::State;
+using dhe::StateMachine;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+
+enum class Light { Red, Green };
+
+struct TrafficLight {
+  template <Light I> using Is = State<Light, I>;
+
+  void enter(Is<Light::Red> /*state*/) { log_ += "enter red;"; }
+  void exit(Is<Light::Red> /*state*/) { log_ += "exit red;"; }
+  void execute(Is<Light::Red> /*state*/, float sample_time) {
+    log_ += "execute red;";
+    sample_time_ = sample_time;
+  }
+
+  void enter(Is<Light::Green> /*state*/) { log_ += "enter green;"; }
+  void exit(Is<Light::Green> /*state*/) { log_ += "exit green;"; }
+  void execute(Is<Light::Green> /*state*/, float /*sample_time*/) {
+    log_ += "execute green;";
+    lights_.enter(*this, Light::Red);
+  }
+
+  using Lights = StateMachine<TrafficLight, Light, Light::Red, Light::Green>;
+
+  std::string log_{};         // NOLINT
+  float sample_time_{};       // NOLINT
+  Lights lights_{Light::Red}; // NOLINT
+};
+
+class StateMachineSuite : public Suite {
+public:
+  StateMachineSuite() : Suite{"dhe::StateMachine"} {}
+
+  void run(Tester &t) override {
+    t.run("starts in the initial state without entering it", [](Tester &t) {
+      auto light = TrafficLight{};
+
+      if (light.lights_.id() != Light::Red) {
+        t.error("Did not start in the initial state");
+      }
+      if (!light.log_.empty()) {
+        t.errorf("Got log {}, want empty", light.log_);
+      }
+    });
+
+    t.run("exits the current state before entering the next", [](Tester &t) {
+      auto light = TrafficLight{};
+
+      light.lights_.enter(light, Light::Green);
+
+      if (light.lights_.id() != Light::Green) {
+        t.error("Did not change state");
+      }
+      if (light.log_ != "exit red;enter green;") {
+        t.errorf("Got log {}", light.log_);
+      }
+    });
+
+    t.run("executes the current state", [](Tester &t) {
+      auto light = TrafficLight{};
+
+      light.lights_.execute(light, 0.25F);
+
+      if (light.log_ != "execute red;") {
+        t.errorf("Got log {}", light.log_);
+      }
+      if (light.sample_time_ != 0.25F) {
+        t.errorf("Got sample time {}, want 0.25", light.sample_time_);
+      }
+    });
+
+    t.run("a state can change state while executing", [](Tester &t) {
+      auto light = TrafficLight{};
+      light.lights_.enter(light, Light::Green);
+      light.log_.clear();
+
+      light.lights_.execute(light, 0.F);
+
+      if (light.lights_.id() != Light::Red) {
+        t.error("Did not change state");
+      }
+      if (light.log_ != "execute green;exit green;enter red;") {
+        t.errorf("Got log {}", light.log_);
+      }
+    });
+  }
+};
+
+static auto _ = StateMachineSuite{};
+} // namespace test
+} // namespace components
+} // namespace dhe
@@ -0,0 +1,99 @@
+#include "components/throttle.h"
+
+#include "dheunit/test.h"
+
+#include <string>
+#include <vector>
+
+namespace dhe {
+namespace components {
+namespace test {
+using dhe::Throttle;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+
+struct ThrottleTest {
+  std::string const name_;             // NOLINT
+  int const interval_;                 // NOLINT
+  std::vector<bool> const want_ticks_; // NOLINT
+
+  void run(Tester &t) const {
+    t.run(name_, [this](Tester &t) {
+      auto throttle = Throttle{interval_};
+      for (auto i = 0U; i < want_ticks_.size(); i++) {
+        auto const permitted = throttle.tick();
+        if (permitted != want_ticks_[i]) {
+          t.errorf("tick {} returned {}, want {}", i, permitted,
+                   want_ticks_[i]);
+        }
+      }
+    });
+  }
+};
+
+static auto const throttle_tests = std::vector<ThrottleTest>{
+    {
+        .name_ = "default interval permits every tick",
+        .interval_ = 1,
+        .want_ticks_ = {true, true, true, true},
+    },
+    {
+        .name_ = "permits first tick",
+        .interval_ = 4,
+        .want_ticks_ = {true},
+    },
+    {
+        .name_ = "permits one tick per interval",
+        .interval_ = 3,
+        .want_ticks_ = {true, false, false, true, false, false, true},
+    },
+};
+
+class ThrottleSuite : public Suite {
+public:
+  ThrottleSuite() : Suite{"dhe::Throttle"} {}
+
+  void run(Tester &t) override {
+    for (auto const &test : throttle_tests) {
+      test.run(t);
+    }
+
+    t.run("new interval takes effect after the next permitted tick",
+          [](Tester &t) {
+            auto throttle = Throttle{3};
+            throttle.tick();
+            throttle.set_interval(2);
+            auto const want_ticks =
+                std::vector<bool>{false, false, true, false, true};
+            for (auto i = 0U; i < want_ticks.size(); i++) {
+              auto const permitted = throttle.tick();
+              if (permitted != want_ticks[i]) {
+                t.errorf("tick {} returned {}, want {}", i, permitted,
+                         want_ticks[i]);
+              }
+            }
+          });
+
+    t.run("light update interval scales with the sample rate", [](Tester &t) {
+      auto const at_default = light_update_interval_at(default_sample_rate);
+      if (at_default != light_update_interval) {
+        t.errorf("at {} Hz got {}, want {}", default_sample_rate, at_default,
+                 light_update_interval);
+      }
+      auto const at_double = light_update_interval_at(88200.F);
+      if (at_double != 2 * light_update_interval) {
+        t.errorf("at 88200 Hz got {}, want {}", at_double,
+                 2 * light_update_interval);
+      }
+      auto const at_low = light_update_interval_at(100.F);
+      if (at_low != 1) {
+        t.errorf("at 100 Hz got {}, want 1", at_low);
+      }
+    });
+  }
+};
+
+static auto _ = ThrottleSuite{};
+} // namespace test
+} // namespace components
+} // namespace dhe
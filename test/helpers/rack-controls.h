@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 namespace test {
 namespace fake {
 
@@ -24,13 +26,25 @@ private:
 };
 
 struct Port {
-  constexpr Port() = default;
-  constexpr explicit Port(float voltage) : voltage_{voltage} {}
-  auto getVoltage() const -> float { return voltage_; } // NOLINT
-  void setVoltage(float v) { voltage_ = v; }            // NOLINT
+  static auto constexpr max_channels = 16;
+
+  Port() { voltages_.fill(-3333.F); }
+  explicit Port(float voltage) { voltages_.fill(voltage); }
+  auto getChannels() const -> int { return channels_; } // NOLINT
+  auto getPolyVoltage(int c) const -> float {           // NOLINT
+    return voltages_[channels_ == 1 ? 0 : c];
+  }
+  template <typename T> auto getPolyVoltageSimd(int c) const -> T { // NOLINT
+    return T{getPolyVoltage(c), getPolyVoltage(c + 1), getPolyVoltage(c + 2),
+             getPolyVoltage(c + 3)};
+  }
+  auto getVoltage(int c = 0) const -> float { return voltages_[c]; } // NOLINT
+  void setChannels(int channels) { channels_ = channels; }          // NOLINT
+  void setVoltage(float v, int c = 0) { voltages_[c] = v; }         // NOLINT
 
 private:
-  float voltage_{-3333.F};
+  std::array<float, max_channels> voltages_{};
+  int channels_{1};
 };
 
 } // namespace fake
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace test {
+namespace fake {
+
+// A stand-in for rack::simd::float_4. Comparisons yield lane masks whose lanes
+// have every bit set (true) or clear (false), as with Rack's SSE vectors.
+struct float_4 {
+  static auto constexpr size = 4;
+
+  float_4() = default;
+  float_4(float f) : s{f, f, f, f} {} // NOLINT
+  float_4(float a, float b, float c, float d) : s{a, b, c, d} {}
+
+  static auto mask() -> float_4 {
+    auto m = float_4{};
+    for (auto &lane : m.s) {
+      auto const ones = ~std::uint32_t{0};
+      std::memcpy(&lane, &ones, sizeof(lane));
+    }
+    return m;
+  }
+
+  auto operator[](int i) const -> float { return s[i]; }
+
+  float s[size]{}; // NOLINT
+};
+
+namespace simd {
+static inline auto bits(float f) -> std::uint32_t {
+  auto b = std::uint32_t{};
+  std::memcpy(&b, &f, sizeof(b));
+  return b;
+}
+
+static inline auto from_bits(std::uint32_t b) -> float {
+  auto f = 0.F;
+  std::memcpy(&f, &b, sizeof(f));
+  return f;
+}
+
+template <typename F>
+static inline auto map(float_4 a, float_4 b, F f) -> float_4 {
+  auto r = float_4{};
+  for (auto i = 0; i < float_4::size; i++) {
+    r.s[i] = f(a.s[i], b.s[i]);
+  }
+  return r;
+}
+
+template <typename F>
+static inline auto compare(float_4 a, float_4 b, F f) -> float_4 {
+  return map(a, b, [f](float x, float y) {
+    return from_bits(f(x, y) ? ~std::uint32_t{0} : 0U);
+  });
+}
+
+template <typename F>
+static inline auto bitwise(float_4 a, float_4 b, F f) -> float_4 {
+  return map(a, b,
+             [f](float x, float y) { return from_bits(f(bits(x), bits(y))); });
+}
+} // namespace simd
+
+static inline auto operator+(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, std::plus<float>{});
+}
+
+static inline auto operator-(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, std::minus<float>{});
+}
+
+static inline auto operator*(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, std::multiplies<float>{});
+}
+
+static inline auto operator/(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, std::divides<float>{});
+}
+
+static inline auto operator==(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::equal_to<float>{});
+}
+
+static inline auto operator!=(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::not_equal_to<float>{});
+}
+
+static inline auto operator<(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::less<float>{});
+}
+
+static inline auto operator<=(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::less_equal<float>{});
+}
+
+static inline auto operator>(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::greater<float>{});
+}
+
+static inline auto operator>=(float_4 a, float_4 b) -> float_4 {
+  return simd::compare(a, b, std::greater_equal<float>{});
+}
+
+static inline auto operator&(float_4 a, float_4 b) -> float_4 {
+  return simd::bitwise(a, b, std::bit_and<std::uint32_t>{});
+}
+
+static inline auto operator|(float_4 a, float_4 b) -> float_4 {
+  return simd::bitwise(a, b, std::bit_or<std::uint32_t>{});
+}
+
+static inline auto operator^(float_4 a, float_4 b) -> float_4 {
+  return simd::bitwise(a, b, std::bit_xor<std::uint32_t>{});
+}
+
+static inline auto operator-(float_4 a) -> float_4 { return float_4{0.F} - a; }
+
+static inline auto operator~(float_4 a) -> float_4 {
+  return a ^ float_4::mask();
+}
+
+static inline auto movemask(float_4 a) -> int {
+  auto m = 0;
+  for (auto i = 0; i < float_4::size; i++) {
+    m |= static_cast<int>(simd::bits(a.s[i]) >> 31U) << i;
+  }
+  return m;
+}
+
+static inline auto ifelse(float_4 mask, float_4 a, float_4 b) -> float_4 {
+  return (mask & a) | (~mask & b);
+}
+
+static inline auto fmin(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, [](float x, float y) { return std::fmin(x, y); });
+}
+
+static inline auto fmax(float_4 a, float_4 b) -> float_4 {
+  return simd::map(a, b, [](float x, float y) { return std::fmax(x, y); });
+}
+
+static inline auto abs(float_4 a) -> float_4 {
+  return simd::map(a, a, [](float x, float /**/) { return std::fabs(x); });
+}
+
+} // namespace fake
+} // namespace test
@@ -0,0 +1,61 @@
+#include "modules/buttons/engine.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+#include "helpers/rack-controls.h"
+
+#include <vector>
+
+namespace test {
+namespace buttons {
+using dhe::buttons::button_count;
+using dhe::buttons::OutputId;
+using dhe::buttons::ParamId;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+using test::fake::Param;
+using test::fake::Port;
+
+using Engine = dhe::buttons::Engine<Param, Port>;
+
+class ButtonsEngineSuite : public Suite {
+public:
+  ButtonsEngineSuite() : Suite{"dhe::buttons::Engine"} {}
+
+  void run(Tester &t) override {
+    t.run("ALL and ¬ALL carry each button's voltage and its negation",
+          [](Tester &t) {
+            auto params = std::vector<Param>(ParamId::Count, Param{0.F});
+            auto outputs = std::vector<Port>(OutputId::Count);
+            auto engine = Engine{params, outputs};
+
+            // A: button only. B: negate only. C: both. D-H: neither.
+            params[ParamId::Button + 0].setValue(1.F);
+            params[ParamId::Negate + 1].setValue(1.F);
+            params[ParamId::Button + 2].setValue(1.F);
+            params[ParamId::Negate + 2].setValue(1.F);
+
+            engine.process();
+
+            auto const &all = outputs[OutputId::All];
+            auto const &negated_all = outputs[OutputId::NegatedAll];
+            assert_that(t, "ALL channels", all.getChannels(),
+                        is_equal_to(button_count));
+            assert_that(t, "¬ALL channels", negated_all.getChannels(),
+                        is_equal_to(button_count));
+            for (auto i = 0; i < button_count; i++) {
+              auto const want = i < 2 ? 10.F : 0.F;
+              auto const out = outputs[OutputId::Out + i].getVoltage();
+              assert_that(t, "out", out, is_equal_to(want));
+              assert_that(t, "ALL", all.getVoltage(i), is_equal_to(want));
+              assert_that(t, "¬ALL", negated_all.getVoltage(i),
+                          is_equal_to(10.F - want));
+            }
+          });
+  }
+};
+
+static auto _ = ButtonsEngineSuite{};
+} // namespace buttons
+} // namespace test
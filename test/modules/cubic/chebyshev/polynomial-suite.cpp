@@ -0,0 +1,107 @@
+#include "modules/cubic/chebyshev/polynomial.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+#include "helpers/simd.h"
+
+#include <cmath>
+#include <string>
+
+namespace test {
+namespace cubic {
+namespace chebyshev {
+using dhe::cubic::chebyshev::harmonic_count;
+using dhe::cubic::chebyshev::LaneWeights;
+using dhe::cubic::chebyshev::Polynomial;
+using dhe::cubic::chebyshev::Weights;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::fake::float_4;
+using test::is_equal_to;
+using test::is_near;
+
+static auto constexpr tolerance = 1e-4F;
+
+class ChebyshevPolynomialSuite : public Suite {
+public:
+  ChebyshevPolynomialSuite()
+      : Suite{"dhe::cubic::chebyshev::Polynomial"} {}
+
+  void run(Tester &t) override {
+    t.run("is zero before weights are set", [](Tester &t) {
+      auto const f = Polynomial{};
+      assert_that(t, f(0.5F), is_equal_to(0.F));
+    });
+
+    t.run("each weight yields its harmonic of a cosine", [](Tester &t) {
+      // Tk(cos(theta)) = cos(k theta)
+      auto constexpr theta = 0.3F;
+      for (auto k = 1; k <= harmonic_count; k++) {
+        auto weights = Weights{};
+        weights[k - 1] = 1.F;
+        auto f = Polynomial{};
+        f.set_weights(weights);
+
+        assert_that(t, "T" + std::to_string(k), f(std::cos(theta)),
+                    is_near(std::cos(static_cast<float>(k) * theta),
+                            tolerance));
+      }
+    });
+
+    t.run("sums the weighted harmonics", [](Tester &t) {
+      auto f = Polynomial{};
+      auto weights = Weights{};
+      weights[0] = 0.5F; // T1 = x
+      weights[1] = -2.F; // T2 = 2x^2 - 1
+      f.set_weights(weights);
+
+      auto constexpr x = 0.4F;
+      auto const want = 0.5F * x - 2.F * (2.F * x * x - 1.F);
+      assert_that(t, f(x), is_near(want, tolerance));
+    });
+
+    t.run("follows changes to the weights", [](Tester &t) {
+      auto f = Polynomial{};
+      auto weights = Weights{};
+      weights[0] = 1.F;
+      f.set_weights(weights);
+      weights[0] = 0.F;
+      weights[2] = 1.F; // T3 = 4x^3 - 3x
+      f.set_weights(weights);
+
+      assert_that(t, f(1.F), is_near(1.F, tolerance));
+      assert_that(t, f(0.5F), is_near(-1.F, tolerance));
+    });
+
+    t.run("clamps its input to [-1, 1]", [](Tester &t) {
+      auto f = Polynomial{};
+      auto weights = Weights{};
+      weights[7] = 1.F; // T8
+      f.set_weights(weights);
+
+      assert_that(t, f(3.F), is_near(1.F, tolerance));
+      assert_that(t, f(-3.F), is_near(1.F, tolerance));
+    });
+
+    t.run("weights each lane by its own weights", [](Tester &t) {
+      auto weights = LaneWeights<float_4>{};
+      weights[0] = float_4{1.F, 0.F, 0.F, 0.5F}; // T1 = x
+      weights[1] = float_4{0.F, 1.F, 0.F, 0.5F}; // T2 = 2x^2 - 1
+      weights[2] = float_4{0.F, 0.F, 1.F, 0.F};  // T3 = 4x^3 - 3x
+
+      auto constexpr x = 0.5F;
+      auto const y = Polynomial::evaluate(weights, float_4{x});
+
+      assert_that(t, "T1", y[0], is_near(x, tolerance));
+      assert_that(t, "T2", y[1], is_near(2.F * x * x - 1.F, tolerance));
+      assert_that(t, "T3", y[2], is_near(4.F * x * x * x - 3.F * x, tolerance));
+      assert_that(t, "mix", y[3],
+                  is_near(0.5F * x + 0.5F * (2.F * x * x - 1.F), tolerance));
+    });
+  }
+};
+
+static auto _ = ChebyshevPolynomialSuite{};
+} // namespace chebyshev
+} // namespace cubic
+} // namespace test
@@ -0,0 +1,87 @@
+#include "modules/cubic/shaper.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+namespace test {
+namespace cubic {
+using dhe::cubic::AntialiasedShaper;
+using dhe::cubic::Polynomial;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_near;
+
+static auto constexpr tolerance = 1e-5F;
+
+class AntialiasedShaperSuite : public Suite {
+public:
+  AntialiasedShaperSuite() : Suite{"dhe::cubic::AntialiasedShaper"} {}
+
+  void run(Tester &t) override {
+    t.run("steady input yields the polynomial's value", [](Tester &t) {
+      auto const f = Polynomial{1.F, -0.5F, 0.25F, 0.1F};
+      auto shaper = AntialiasedShaper{};
+      shaper.apply(f, 0.6F);
+
+      assert_that(t, shaper.apply(f, 0.6F), is_near(f(0.6F), tolerance));
+    });
+
+    t.run("yields the average over the step between samples", [](Tester &t) {
+      auto const cubed = Polynomial{1.F, 0.F, 0.F, 0.F};
+      auto shaper = AntialiasedShaper{};
+      shaper.apply(cubed, 0.F);
+
+      // The average of x^3 from 0 to 1 is 1/4
+      assert_that(t, shaper.apply(cubed, 1.F), is_near(0.25F, tolerance));
+    });
+
+    t.run("linear polynomial yields the midpoint", [](Tester &t) {
+      auto const line = Polynomial{0.F, 0.F, 2.F, 1.F};
+      auto shaper = AntialiasedShaper{};
+      shaper.apply(line, -0.5F);
+
+      assert_that(t, shaper.apply(line, 0.3F),
+                  is_near(line(-0.1F), tolerance));
+    });
+
+    t.run("nearly equal samples yield the value at the midpoint",
+          [](Tester &t) {
+            auto const f = Polynomial{1.F, 1.F, 1.F, 1.F};
+            auto shaper = AntialiasedShaper{};
+            shaper.apply(f, 0.5F);
+
+            assert_that(t, shaper.apply(f, 0.5001F),
+                        is_near(f(0.50005F), tolerance));
+          });
+
+    t.run("a skipped sample is the start of the next step", [](Tester &t) {
+      auto const f = Polynomial{1.F, -0.5F, 0.25F, 0.1F};
+      auto shaper = AntialiasedShaper{};
+      shaper.apply(f, -0.8F);
+      shaper.skip(0.6F);
+
+      assert_that(t, shaper.apply(f, 0.6F), is_near(f(0.6F), tolerance));
+    });
+
+    t.run("small steps keep their precision", [](Tester &t) {
+      auto const f = Polynomial{1.F, 1.F, 1.F, 1.F};
+      auto const x1 = 1.F;
+      auto const x2 = 1.002F;
+      auto shaper = AntialiasedShaper{};
+      shaper.apply(f, x1);
+
+      // Simpson's rule is exact for a cubic
+      auto const at = [](double x) { return ((x + 1.) * x + 1.) * x + 1.; };
+      auto const a = static_cast<double>(x1);
+      auto const b = static_cast<double>(x2);
+      auto const want = (at(a) + 4. * at(0.5 * (a + b)) + at(b)) / 6.;
+
+      assert_that(t, shaper.apply(f, x2),
+                  is_near(static_cast<float>(want), tolerance));
+    });
+  }
+};
+
+static auto _ = AntialiasedShaperSuite{};
+} // namespace cubic
+} // namespace test
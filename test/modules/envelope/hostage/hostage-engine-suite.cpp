@@ -7,6 +7,7 @@ namespace hostage {
 
 using dhe::unit::Suite;
 using dhe::unit::Tester;
+using test::is_false;
 using test::is_true;
 
 // Nothing to do, because the state is already freshly constructed
@@ -16,6 +17,23 @@ freshly_constructed(Signals & /*signals*/, SimpleMode & /*input_mode*/,
                     LatchedMode & /*sustain_mode*/, SimpleMode & /*idle_mode*/,
                     HostageEngine & /*engine*/) {}
 
+// Sustains until the gate falls, then idles until the engine falls asleep
+static inline void
+asleep_in_idle_mode(Signals &signals, SimpleMode & /*input_mode*/,
+                    SimpleMode & /*defer_mode*/, TimedMode & /*hold_mode*/,
+                    LatchedMode &sustain_mode, SimpleMode &idle_mode,
+                    HostageEngine &engine) {
+  engine.on_sample_rate_change(1e-3F);
+  signals.mode_ = dhe::envelope::ModeId::Sustain;
+  signals.gate_ = true;
+  engine.process(1e-3F); // Enters sustain mode
+  signals.gate_ = false;
+  sustain_mode.event_ = Event::Completed;
+  engine.process(1e-3F); // Sustain completes, and engine enters idle mode
+  engine.process(1e-3F); // EOC ends, and engine falls asleep
+  idle_mode = SimpleMode{};
+}
+
 class HostageEngineSuite : public Suite {
 public:
   HostageEngineSuite() : Suite{"dhe::envelope::hostage::Engine"} {}
@@ -29,6 +47,65 @@ public:
                  engine.process(0.F);
                  assert_that(t, input_mode.executed_, is_true);
                }));
+
+    t.run("keeps executing input mode while resting in it",
+          test(freshly_constructed,
+               [](Tester &t, Signals & /*signals*/, SimpleMode &input_mode,
+                  SimpleMode & /*defer_mode*/, TimedMode & /*hold_mode*/,
+                  LatchedMode & /*sustain_mode*/, SimpleMode & /*idle_mode*/,
+                  HostageEngine &engine) {
+                 engine.process(0.F);
+                 engine.process(0.F);
+                 input_mode = SimpleMode{};
+
+                 engine.process(0.F);
+
+                 assert_that(t, input_mode.executed_, is_true);
+               }));
+
+    t.run("shows no eoc and executes no mode while asleep",
+          test(asleep_in_idle_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /*input_mode*/,
+                  SimpleMode & /*defer_mode*/, TimedMode & /*hold_mode*/,
+                  LatchedMode & /*sustain_mode*/, SimpleMode &idle_mode,
+                  HostageEngine &engine) {
+                 signals.showed_eoc_ = false;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, "execute idle", idle_mode.executed_,
+                             is_false);
+                 assert_that(t, "showed eoc", signals.showed_eoc_, is_true);
+                 assert_that(t, "eoc", signals.eoc_, is_false);
+               }));
+
+    t.run("wakes and holds if gate rises while asleep",
+          test(asleep_in_idle_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /*input_mode*/,
+                  SimpleMode & /*defer_mode*/, TimedMode &hold_mode,
+                  LatchedMode & /*sustain_mode*/, SimpleMode &idle_mode,
+                  HostageEngine &engine) {
+                 signals.mode_ = dhe::envelope::ModeId::Hold;
+                 signals.gate_ = true;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, "exit idle", idle_mode.exited_, is_true);
+                 assert_that(t, "enter hold", hold_mode.entered_, is_true);
+               }));
+
+    t.run("wakes and defers if defer rises while asleep",
+          test(asleep_in_idle_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /*input_mode*/,
+                  SimpleMode &defer_mode, TimedMode & /*hold_mode*/,
+                  LatchedMode & /*sustain_mode*/, SimpleMode & /*idle_mode*/,
+                  HostageEngine &engine) {
+                 signals.defer_ = true;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, defer_mode.entered_, is_true);
+               }));
   }
 };
 
@@ -0,0 +1,262 @@
+#include "modules/envelope/hostage/poly-engine.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+#include "helpers/simd.h"
+
+#include <array>
+#include <functional>
+
+namespace test {
+namespace hostage {
+namespace poly {
+using dhe::envelope::ModeId;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::fake::float_4;
+using TestFunc = std::function<void(Tester &)>;
+
+static auto constexpr channel_count = 8;
+static auto constexpr sample_time = 0.5e-3F;
+
+using Voltages = std::array<float, channel_count>;
+
+static inline auto lanes(Voltages const &voltages, int channel) -> float_4 {
+  return float_4{voltages[channel], voltages[channel + 1],
+                 voltages[channel + 2], voltages[channel + 3]};
+}
+
+static inline void store(Voltages &voltages, int channel, float_4 v) {
+  for (auto i = 0; i < float_4::size; i++) {
+    voltages[channel + i] = v[i];
+  }
+}
+
+struct Signals {
+  Signals() { duration_.fill(1.25e-3F); }
+
+  auto defer(int channel) const -> float_4 {
+    return lanes(defer_, channel) > 1.F;
+  }
+  auto duration(int channel) const -> float_4 {
+    return lanes(duration_, channel);
+  }
+  auto gate(int channel) const -> float_4 {
+    return lanes(gate_, channel) > 1.F;
+  }
+  auto input(int channel) const -> float_4 { return lanes(input_, channel); }
+  auto mode() const -> ModeId { return mode_; }
+
+  void output(int channel, float_4 v) { store(output_, channel, v); }
+  void show_active(int channel, float_4 m) { store(active_, channel, m); }
+  void show_eoc(int channel, float_4 m) { store(eoc_, channel, m); }
+
+  auto is_active(int channel) const -> bool {
+    return movemask(float_4{active_[channel]}) != 0;
+  }
+  auto is_eoc(int channel) const -> bool {
+    return movemask(float_4{eoc_[channel]}) != 0;
+  }
+
+  Voltages defer_{};    // NOLINT
+  Voltages duration_{}; // NOLINT
+  Voltages gate_{};     // NOLINT
+  Voltages input_{};    // NOLINT
+  ModeId mode_{};       // NOLINT
+  Voltages output_{};   // NOLINT
+  Voltages active_{};   // NOLINT
+  Voltages eoc_{};      // NOLINT
+};
+
+using Engine =
+    dhe::envelope::hostage::PolyEngine<float_4, Signals, channel_count>;
+
+template <typename Run> auto test(Run run) -> TestFunc {
+  return [run](Tester &t) {
+    Signals signals{};
+    Engine engine{signals};
+    engine.on_sample_rate_change(sample_time);
+    run(t, signals, engine);
+  };
+}
+
+class HostagePolyEngineSuite : Suite {
+public:
+  HostagePolyEngineSuite() : Suite{"dhe::envelope::hostage::PolyEngine"} {}
+
+  void run(Tester &t) override {
+    t.run("sends each channel's input while in input mode",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            for (auto c = 0; c < channel_count; c++) {
+              signals.input_[c] = static_cast<float>(c);
+            }
+
+            engine.process(channel_count, sample_time);
+
+            for (auto c = 0; c < channel_count; c++) {
+              assert_that(t, signals.output_[c],
+                          is_equal_to(static_cast<float>(c)));
+              assert_that(t, signals.is_active(c), is_false);
+            }
+          }));
+
+    t.run("a hold holds its input for its duration, then raises EOC",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Hold;
+            signals.input_.fill(4.F);
+            signals.gate_[2] = 10.F;
+            engine.process(channel_count, sample_time); // 40% of the hold
+
+            signals.input_.fill(6.F);
+            engine.process(channel_count, sample_time); // 80% of the hold
+
+            assert_that(t, "held", signals.output_[2], is_equal_to(4.F));
+            assert_that(t, "active while holding", signals.is_active(2),
+                        is_true);
+            assert_that(t, "other channel", signals.output_[3],
+                        is_equal_to(6.F));
+
+            engine.process(channel_count, sample_time); // 120% of the hold
+
+            assert_that(t, "held after end", signals.output_[2],
+                        is_equal_to(4.F));
+            assert_that(t, "active after end", signals.is_active(2), is_false);
+            assert_that(t, "eoc after end", signals.is_eoc(2), is_true);
+          }));
+
+    t.run("a sustain holds its output until its gate falls",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Sustain;
+            signals.input_.fill(4.F);
+            engine.process(channel_count, sample_time);
+
+            signals.gate_[5] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            signals.input_.fill(6.F);
+            for (auto i = 0; i < 10; i++) {
+              engine.process(channel_count, sample_time);
+            }
+
+            assert_that(t, "sustained", signals.output_[5], is_equal_to(4.F));
+            assert_that(t, "active while sustaining", signals.is_active(5),
+                        is_true);
+            assert_that(t, "eoc while sustaining", signals.is_eoc(5),
+                        is_false);
+
+            signals.gate_[5] = 0.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "idled", signals.output_[5], is_equal_to(4.F));
+            assert_that(t, "active after fall", signals.is_active(5),
+                        is_false);
+            assert_that(t, "eoc after fall", signals.is_eoc(5), is_true);
+          }));
+
+    t.run("in sustain mode, a falling defer idles and raises EOC",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Sustain;
+            signals.input_[6] = 3.F;
+            signals.defer_[6] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "deferring out", signals.output_[6],
+                        is_equal_to(3.F));
+            assert_that(t, "active while deferring", signals.is_active(6),
+                        is_true);
+
+            signals.defer_[6] = 0.F;
+            signals.input_[6] = 8.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "idled", signals.output_[6], is_equal_to(3.F));
+            assert_that(t, "eoc after defer falls", signals.is_eoc(6),
+                        is_true);
+          }));
+
+    t.run("in hold mode, a falling defer returns to input mode",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Hold;
+            signals.defer_[1] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            signals.defer_[1] = 0.F;
+            signals.input_[1] = 8.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "out", signals.output_[1], is_equal_to(8.F));
+            assert_that(t, "eoc", signals.is_eoc(1), is_false);
+          }));
+
+    t.run("sleeps in input mode while its inputs are constant",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.input_.fill(3.F);
+            engine.process(channel_count, sample_time);
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "asleep", engine.is_asleep(0), is_true);
+            assert_that(t, "out", signals.output_[1], is_equal_to(3.F));
+          }));
+
+    t.run("a sleeping channel in input mode sends its new input",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.input_[6] = 5.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, signals.output_[6], is_equal_to(5.F));
+          }));
+
+    t.run("sleeps in idle mode after the EOC pulse ends",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Sustain;
+            signals.input_.fill(4.F);
+            engine.process(channel_count, sample_time); // Sends input
+            signals.gate_[1] = 10.F;
+            engine.process(channel_count, sample_time); // Sustains
+            signals.gate_[1] = 0.F;
+            engine.process(channel_count, sample_time); // Idles, EOC rises
+            assert_that(t, "asleep during EOC", engine.is_asleep(0), is_false);
+
+            for (auto i = 0; i < 2; i++) {
+              engine.process(channel_count, sample_time); // EOC runs 1ms
+            }
+            signals.input_.fill(6.F);
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "asleep", engine.is_asleep(0), is_true);
+            assert_that(t, "idle out", signals.output_[1], is_equal_to(4.F));
+            assert_that(t, "input out", signals.output_[0], is_equal_to(6.F));
+            assert_that(t, "eoc", signals.is_eoc(1), is_false);
+          }));
+
+    t.run("a sleeping channel wakes and holds when its gate rises",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.mode_ = ModeId::Hold;
+            signals.input_.fill(2.F);
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.gate_[5] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "asleep", engine.is_asleep(4), is_false);
+            assert_that(t, "active", signals.is_active(5), is_true);
+          }));
+
+    t.run("a sleeping channel wakes and defers when defer rises",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.defer_[3] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, signals.is_active(3), is_true);
+          }));
+  }
+};
+
+static auto _ = HostagePolyEngineSuite{};
+} // namespace poly
+} // namespace hostage
+} // namespace test
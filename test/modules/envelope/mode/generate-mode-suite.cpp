@@ -66,6 +66,25 @@ public:
             assert_that(t, timer.phase(), is_equal_to(phase_delta));
           }));
 
+    t.run("execute(l,s) advances only through the portion after a rise",
+          test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
+                                GenerateMode &mode) {
+            mode.enter(); // resets the timer phase to 0
+
+            auto constexpr full_duration = 3.F;
+            auto constexpr phase_delta = 0.1F;
+            auto constexpr sample_time = full_duration * phase_delta;
+            auto constexpr edge_fraction = 0.25F;
+
+            auto latch = dhe::Latch{};
+            latch.clock(true, edge_fraction);
+
+            signals.duration_ = full_duration;
+            mode.execute(latch, sample_time);
+            assert_that(t, timer.phase(),
+                        is_near(phase_delta * edge_fraction, 1e-6F));
+          }));
+
     t.run("execute(l,s) outputs_ curve voltage",
           test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
                                 GenerateMode &mode) {
@@ -134,6 +153,57 @@ public:
             assert_that(t, signals.output_, is_equal_to(expected_output));
           }));
 
+    t.run("execute(l,s) follows curve changes if not latched",
+          test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
+                                GenerateMode &mode) {
+            signals.latches_curve_ = false;
+            signals.input_ = 0.F;
+            signals.level_ = 10.F;
+            signals.duration_ = 1.F;
+            mode.enter();
+
+            signals.level_ = 5.F;
+            signals.duration_ = 0.5F;
+            mode.execute(low_latch, 0.1F);
+
+            assert_that(t, "phase", timer.phase(), is_near(0.2F, 1e-6F));
+            assert_that(t, "output", signals.output_, is_near(1.F, 1e-6F));
+          }));
+
+    t.run("execute(l,s) ignores curve changes if latched",
+          test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
+                                GenerateMode &mode) {
+            signals.latches_curve_ = true;
+            signals.input_ = 0.F;
+            signals.level_ = 10.F;
+            signals.duration_ = 1.F;
+            mode.enter();
+
+            signals.level_ = 5.F;
+            signals.duration_ = 0.5F;
+            mode.execute(low_latch, 0.1F);
+
+            assert_that(t, "phase", timer.phase(), is_near(0.1F, 1e-6F));
+            assert_that(t, "output", signals.output_, is_near(1.F, 1e-6F));
+          }));
+
+    t.run("execute(l,s) relatches curve on retrigger",
+          test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
+                                GenerateMode &mode) {
+            signals.latches_curve_ = true;
+            signals.input_ = 0.F;
+            signals.level_ = 10.F;
+            signals.duration_ = 1.F;
+            mode.enter();
+
+            signals.level_ = 5.F;
+            signals.duration_ = 0.5F;
+            mode.execute(rising_latch, 0.1F);
+
+            assert_that(t, "phase", timer.phase(), is_near(0.2F, 1e-6F));
+            assert_that(t, "output", signals.output_, is_near(1.F, 1e-6F));
+          }));
+
     t.run("execute(l,s) reports generated if timer not expired",
           test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
                                 GenerateMode &mode) {
@@ -154,6 +224,18 @@ public:
             assert_that(t, result, is_equal_to(Event::Completed));
           }));
 
+    t.run("execute(l,s) reports the time left after completion",
+          test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer &timer,
+                                GenerateMode &mode) {
+            signals.duration_ = 1.F;
+            mode.enter();
+            timer.advance(0.75F);
+
+            mode.execute(low_latch, 0.5F);
+
+            assert_that(t, mode.leftover_time(), is_near(0.25F, 1e-6F));
+          }));
+
     t.run("exit() deactivates stage",
           test<GenerateMode>([](Tester &t, Signals &signals, PhaseTimer & /**/,
                                 GenerateMode &mode) {
@@ -18,6 +18,7 @@ using TestFunc = std::function<void(Tester &)>;
 struct Signals {
   auto curvature() const -> float { return curvature_; }
   auto duration() const -> float { return duration_; }
+  auto latches_curve() const -> bool { return latches_curve_; }
   auto level() const -> float { return level_; }
   auto input() const -> float { return input_; }
   void output(float f) { output_ = f; }
@@ -27,6 +28,7 @@ struct Signals {
   float duration_{};               // NOLINT
   float curvature_{};              // NOLINT
   float input_{};                  // NOLINT
+  bool latches_curve_{};           // NOLINT
   float level_{};                  // NOLINT
   float output_{};                 // NOLINT
   Shape::Id shape_ = Shape::Id::J; // NOLINT
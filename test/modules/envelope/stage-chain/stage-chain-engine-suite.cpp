@@ -0,0 +1,162 @@
+#include "modules/envelope/stage-chain/control-ids.h"
+#include "modules/envelope/stage-chain/engine.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+#include "helpers/rack-controls.h"
+
+#include <functional>
+#include <vector>
+
+namespace test {
+namespace stage_chain {
+using dhe::envelope::stage_chain::InputId;
+using dhe::envelope::stage_chain::OutputId;
+using dhe::envelope::stage_chain::ParamId;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::fake::Param;
+using test::fake::Port;
+using Engine = dhe::envelope::stage_chain::Engine<Param, Port, Port>;
+using TestFunc = std::function<void(Tester &)>;
+
+static auto constexpr sample_time = 1e-4F;
+static auto constexpr shortest = 0.F; // 10ms
+static auto constexpr one_second = 0.5F;
+static auto constexpr linear = 0.5F;
+static auto constexpr zero_volts = 0.F;
+static auto constexpr five_volts = 0.5F;
+static auto constexpr ten_volts = 1.F;
+
+struct Module {
+  Module() {
+    params_[ParamId::AttackLevel].setValue(ten_volts);
+    params_[ParamId::AttackCurvature].setValue(linear);
+    params_[ParamId::AttackDuration].setValue(one_second);
+    params_[ParamId::DecayLevel].setValue(five_volts);
+    params_[ParamId::DecayCurvature].setValue(linear);
+    params_[ParamId::DecayDuration].setValue(one_second);
+    params_[ParamId::HostageMode].setValue(1.F); // Sustain
+    params_[ParamId::HostageDuration].setValue(one_second);
+    params_[ParamId::ReleaseLevel].setValue(zero_volts);
+    params_[ParamId::ReleaseCurvature].setValue(linear);
+    params_[ParamId::ReleaseDuration].setValue(one_second);
+    params_[ParamId::LatchCurve].setValue(0.F);
+    for (auto &input : inputs_) {
+      input.setVoltage(0.F);
+    }
+    engine_.on_sample_rate_change(sample_time);
+  }
+
+  auto out() const -> float {
+    return outputs_[OutputId::Envelope].getVoltage();
+  }
+
+  std::vector<Param> params_{ParamId::Count};  // NOLINT
+  std::vector<Port> inputs_{InputId::Count};   // NOLINT
+  std::vector<Port> outputs_{OutputId::Count}; // NOLINT
+  Engine engine_{params_, inputs_, outputs_};  // NOLINT
+};
+
+template <typename Run> auto test(Run run) -> TestFunc {
+  return [run](Tester &t) {
+    Module module{};
+    run(t, module);
+  };
+}
+
+class StageChainEngineSuite : Suite {
+public:
+  StageChainEngineSuite() : Suite{"dhe::envelope::stage_chain::Engine"} {}
+
+  void run(Tester &t) override {
+    t.run("attack begins in the sample the gate rises",
+          test([](Tester &t, Module &module) {
+            module.inputs_[InputId::Gate].setVoltage(10.F);
+
+            module.engine_.process(sample_time);
+
+            assert_that(t, "out", 0.F, is_less_than(module.out()));
+            assert_that(t, "active",
+                        module.outputs_[OutputId::Active].getVoltage(),
+                        is_equal_to(10.F));
+          }));
+
+    t.run("decay begins in the sample the attack ends",
+          test([](Tester &t, Module &module) {
+            module.params_[ParamId::AttackDuration].setValue(shortest);
+            module.inputs_[InputId::Gate].setVoltage(10.F);
+
+            // The attack reaches its 10V level on the 101st sample
+            for (auto i = 0; i < 101; i++) {
+              module.engine_.process(sample_time);
+            }
+
+            assert_that(t, module.out(), is_less_than(10.F));
+          }));
+
+    t.run("decay runs only for the part of the sample after the attack ends",
+          test([](Tester &t, Module &module) {
+            auto constexpr long_sample_time = 0.6e-3F;
+            module.params_[ParamId::AttackDuration].setValue(shortest);
+            module.engine_.on_sample_rate_change(long_sample_time);
+            // Rise from the threshold, so that the attack runs for all of the
+            // sample in which the gate rises
+            module.inputs_[InputId::Gate].setVoltage(1.F);
+            module.engine_.process(long_sample_time);
+            module.inputs_[InputId::Gate].setVoltage(10.F);
+
+            // The 10ms attack ends 0.2ms before the end of the 17th sample
+            for (auto i = 0; i < 17; i++) {
+              module.engine_.process(long_sample_time);
+            }
+
+            // 0.2ms into a 1s linear decay from 10V to 5V
+            assert_that(t, module.out(), is_near(9.999F, 1e-4F));
+          }));
+
+    t.run("release begins in the sample the gate falls",
+          test([](Tester &t, Module &module) {
+            module.params_[ParamId::AttackDuration].setValue(shortest);
+            module.params_[ParamId::DecayDuration].setValue(shortest);
+            module.inputs_[InputId::Gate].setVoltage(10.F);
+
+            // Long enough to reach the sustain stage
+            for (auto i = 0; i < 300; i++) {
+              module.engine_.process(sample_time);
+            }
+            auto const sustained = module.out();
+            assert_that(t, "sustained", sustained, is_near(5.F, 0.1F));
+
+            module.inputs_[InputId::Gate].setVoltage(0.F);
+            module.engine_.process(sample_time);
+
+            assert_that(t, "out after gate falls", module.out(),
+                        is_less_than(sustained));
+          }));
+
+    t.run("hold stage ends without the gate",
+          test([](Tester &t, Module &module) {
+            module.params_[ParamId::AttackDuration].setValue(shortest);
+            module.params_[ParamId::DecayDuration].setValue(shortest);
+            module.params_[ParamId::HostageMode].setValue(0.F); // Hold
+            module.params_[ParamId::HostageDuration].setValue(shortest);
+            module.params_[ParamId::ReleaseDuration].setValue(shortest);
+            module.inputs_[InputId::Gate].setVoltage(10.F);
+
+            // Long enough for every stage to end
+            for (auto i = 0; i < 500; i++) {
+              module.engine_.process(sample_time);
+            }
+
+            assert_that(t, "out", module.out(), is_near(0.F, 1e-6F));
+            assert_that(t, "active",
+                        module.outputs_[OutputId::Active].getVoltage(),
+                        is_equal_to(0.F));
+          }));
+  }
+};
+
+static auto _ = StageChainEngineSuite{};
+} // namespace stage_chain
+} // namespace test
@@ -18,14 +18,22 @@ using TestFunc = std::function<void(Tester &)>;
 struct Signals {
   auto defer() const -> bool { return defer_; }
   auto gate() const -> bool { return gate_; }
-  void show_eoc(bool show) {
+  auto gate_edge_fraction() const -> float { return gate_edge_fraction_; }
+  auto level() const -> float { return level_; }
+  void output(float voltage) { output_ = voltage; }
+  void show_eoc(bool show, float edge_fraction) {
     eoc_ = show;
+    eoc_edge_fraction_ = edge_fraction;
     showed_eoc_ = true;
   }
-  bool defer_{};      // NOLINT
-  bool gate_{};       // NOLINT
-  bool showed_eoc_{}; // NOLINT
-  bool eoc_{};        // NOLINT
+  bool defer_{};                  // NOLINT
+  bool gate_{};                   // NOLINT
+  float gate_edge_fraction_{1.F}; // NOLINT
+  float level_{};                 // NOLINT
+  float output_{};                // NOLINT
+  bool showed_eoc_{};             // NOLINT
+  bool eoc_{};                    // NOLINT
+  float eoc_edge_fraction_{};     // NOLINT
 };
 
 struct SimpleMode {
@@ -46,12 +54,14 @@ struct TimedMode {
     sample_time_ = sample_time;
     return event_;
   }
-  bool entered_{};      // NOLINT
-  bool executed_{};     // NOLINT
-  bool exited_{};       // NOLINT
-  Event event_{};       // NOLINT
-  Latch latch_{};       // NOLINT
-  float sample_time_{}; // NOLINT
+  auto leftover_time() const -> float { return leftover_time_; }
+  bool entered_{};        // NOLINT
+  bool executed_{};       // NOLINT
+  bool exited_{};         // NOLINT
+  Event event_{};         // NOLINT
+  Latch latch_{};         // NOLINT
+  float sample_time_{};   // NOLINT
+  float leftover_time_{}; // NOLINT
 };
 
 using StageEngine =
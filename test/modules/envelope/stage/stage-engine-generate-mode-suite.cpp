@@ -124,6 +124,43 @@ public:
           assert_that(t, "enter level", level_mode.entered_, is_true);
           assert_that(t, "execute level", level_mode.executed_, is_false);
         }));
+
+    t.run(
+        "if generate completes: starts eoc where the curve ended",
+        test(in_generate_mode, [](Tester &t, Signals &signals,
+                                  SimpleMode & /**/, SimpleMode & /**/,
+                                  TimedMode &generate_mode, SimpleMode & /**/,
+                                  StageEngine &engine) {
+          auto constexpr sample_time = 0.6e-3F;
+          signals.defer_ = false;
+          generate_mode.event_ = Event::Completed;
+          generate_mode.leftover_time_ = 0.1e-3F;
+          engine.on_sample_rate_change(sample_time);
+
+          engine.process(sample_time); // EOC has run for 0.1ms
+          engine.process(sample_time); // EOC has run for 0.7ms
+
+          assert_that(t, signals.eoc_, is_true);
+
+          engine.process(sample_time); // EOC has run for 1.3ms
+
+          assert_that(t, signals.eoc_, is_false);
+        }));
+
+    t.run(
+        "if generate completes: shows eoc rising where the curve ended",
+        test(in_generate_mode, [](Tester &t, Signals &signals,
+                                  SimpleMode & /**/, SimpleMode & /**/,
+                                  TimedMode &generate_mode, SimpleMode & /**/,
+                                  StageEngine &engine) {
+          signals.defer_ = false;
+          generate_mode.event_ = Event::Completed;
+          generate_mode.leftover_time_ = 0.25e-3F;
+
+          engine.process(1e-3F);
+
+          assert_that(t, signals.eoc_edge_fraction_, is_equal_to(0.25F));
+        }));
   }
 };
 
@@ -53,6 +53,20 @@ public:
           assert_that(t, "execute generate", generate_mode.executed_, is_true);
         }));
 
+    t.run("with defer low: "
+          "if gate rises: passes the gate's edge fraction to generate mode",
+          test(in_input_mode, [](Tester &t, Signals &signals, SimpleMode & /**/,
+                                 SimpleMode & /**/, TimedMode &generate_mode,
+                                 SimpleMode & /**/, StageEngine &engine) {
+            signals.defer_ = false;
+            signals.gate_ = true;
+            signals.gate_edge_fraction_ = 0.8F;
+            engine.process(0.F);
+
+            assert_that(t, generate_mode.latch_.edge_fraction(),
+                        is_equal_to(0.8F));
+          }));
+
     t.run("with defer low: executes if gate does not rise",
           test(in_input_mode, [](Tester &t, Signals &signals, SimpleMode & /**/,
                                  SimpleMode &input_mode, TimedMode & /**/,
@@ -7,6 +7,7 @@ namespace stage {
 
 using dhe::unit::Suite;
 using dhe::unit::Tester;
+using test::is_false;
 using test::is_true;
 
 // Nothing to do, because the state is already freshly constructed
@@ -14,6 +15,24 @@ static inline void freshly_constructed(Signals & /**/, SimpleMode & /**/,
                                        SimpleMode & /**/, TimedMode & /**/,
                                        SimpleMode & /**/, StageEngine & /**/) {}
 
+// Generates a curve that completes at once, then rests in level mode until
+// the engine falls asleep
+static inline void asleep_in_level_mode(Signals &signals, SimpleMode & /**/,
+                                        SimpleMode & /**/,
+                                        TimedMode &generate_mode,
+                                        SimpleMode &level_mode,
+                                        StageEngine &engine) {
+  engine.on_sample_rate_change(1e-3F);
+  signals.level_ = 7.F;
+  generate_mode.event_ = Event::Completed;
+  signals.gate_ = true;
+  engine.process(1e-3F); // Generate completes, and engine enters level mode
+  signals.gate_ = false;
+  engine.process(1e-3F); // Gate falls, and EOC ends
+  engine.process(1e-3F); // Falls asleep
+  level_mode = SimpleMode{};
+}
+
 class StageEngineSuite : public Suite {
 public:
   StageEngineSuite() : Suite{"dhe::envelope::stage::Engine"} {}
@@ -26,6 +45,75 @@ public:
                  engine.process(0.F);
                  assert_that(t, input_mode.executed_, is_true);
                }));
+
+    t.run("keeps executing input mode while resting in it",
+          test(freshly_constructed,
+               [](Tester &t, Signals & /**/, SimpleMode & /**/,
+                  SimpleMode &input_mode, TimedMode & /**/, SimpleMode & /**/,
+                  StageEngine &engine) {
+                 engine.process(0.F);
+                 engine.process(0.F);
+                 input_mode = SimpleMode{};
+
+                 engine.process(0.F);
+
+                 assert_that(t, input_mode.executed_, is_true);
+               }));
+
+    t.run("sends the stored level and shows no eoc while asleep",
+          test(asleep_in_level_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /**/,
+                  SimpleMode & /**/, TimedMode & /**/, SimpleMode &level_mode,
+                  StageEngine &engine) {
+                 signals.output_ = -1.F;
+                 signals.showed_eoc_ = false;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, "execute level", level_mode.executed_,
+                             is_false);
+                 assert_that(t, "output", signals.output_, is_equal_to(7.F));
+                 assert_that(t, "showed eoc", signals.showed_eoc_, is_true);
+                 assert_that(t, "eoc", signals.eoc_, is_false);
+               }));
+
+    t.run("wakes and executes level mode if level changes while asleep",
+          test(asleep_in_level_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /**/,
+                  SimpleMode & /**/, TimedMode & /**/, SimpleMode &level_mode,
+                  StageEngine &engine) {
+                 signals.level_ = 3.F;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, level_mode.executed_, is_true);
+               }));
+
+    t.run("wakes and generates if gate rises while asleep",
+          test(asleep_in_level_mode,
+               [](Tester &t, Signals &signals, SimpleMode & /**/,
+                  SimpleMode & /**/, TimedMode &generate_mode,
+                  SimpleMode &level_mode, StageEngine &engine) {
+                 signals.gate_ = true;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, "exit level", level_mode.exited_, is_true);
+                 assert_that(t, "enter generate", generate_mode.entered_,
+                             is_true);
+               }));
+
+    t.run("wakes and defers if defer rises while asleep",
+          test(asleep_in_level_mode,
+               [](Tester &t, Signals &signals, SimpleMode &defer_mode,
+                  SimpleMode & /**/, TimedMode & /**/, SimpleMode & /**/,
+                  StageEngine &engine) {
+                 signals.defer_ = true;
+
+                 engine.process(1e-3F);
+
+                 assert_that(t, defer_mode.entered_, is_true);
+               }));
   }
 };
 
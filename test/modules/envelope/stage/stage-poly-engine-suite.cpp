@@ -0,0 +1,326 @@
+#include "modules/envelope/stage/poly-engine.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+#include "helpers/simd.h"
+
+#include <array>
+#include <functional>
+
+namespace test {
+namespace stage {
+namespace poly {
+using dhe::Shape;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::fake::float_4;
+using TestFunc = std::function<void(Tester &)>;
+
+static auto constexpr channel_count = 8;
+static auto constexpr sample_time = 1e-3F;
+
+using Voltages = std::array<float, channel_count>;
+
+static inline auto lanes(Voltages const &voltages, int channel) -> float_4 {
+  return float_4{voltages[channel], voltages[channel + 1],
+                 voltages[channel + 2], voltages[channel + 3]};
+}
+
+static inline void store(Voltages &voltages, int channel, float_4 v) {
+  for (auto i = 0; i < float_4::size; i++) {
+    voltages[channel + i] = v[i];
+  }
+}
+
+struct Signals {
+  Signals() {
+    level_.fill(10.F);
+    duration_.fill(10e-3F);
+  }
+
+  auto curvature(int channel) const -> float_4 {
+    return lanes(curvature_, channel);
+  }
+  auto defer(int channel) const -> float_4 {
+    return lanes(defer_, channel) > 1.F;
+  }
+  auto duration(int channel) const -> float_4 {
+    duration_reads_++;
+    return lanes(duration_, channel);
+  }
+  auto gate(int channel) const -> float_4 {
+    return lanes(trigger_, channel) > 1.F;
+  }
+  auto input(int channel) const -> float_4 { return lanes(input_, channel); }
+  auto latches_curve() const -> bool { return latches_curve_; }
+  auto level(int channel) const -> float_4 { return lanes(level_, channel); }
+  auto shape() const -> Shape::Id { return shape_; }
+  auto trigger_voltage(int channel) const -> float_4 {
+    return lanes(trigger_, channel);
+  }
+
+  void output(int channel, float_4 v) { store(output_, channel, v); }
+  void show_active(int channel, float_4 m) { store(active_, channel, m); }
+  void show_eoc(int channel, float_4 m) { store(eoc_, channel, m); }
+
+  auto is_active(int channel) const -> bool {
+    return movemask(float_4{active_[channel]}) != 0;
+  }
+  auto is_eoc(int channel) const -> bool {
+    return movemask(float_4{eoc_[channel]}) != 0;
+  }
+
+  Voltages curvature_{};          // NOLINT
+  Voltages defer_{};              // NOLINT
+  Voltages duration_{};           // NOLINT
+  Voltages input_{};              // NOLINT
+  Voltages level_{};              // NOLINT
+  Voltages trigger_{};            // NOLINT
+  bool latches_curve_{};          // NOLINT
+  Shape::Id shape_{Shape::Id::J}; // NOLINT
+  Voltages output_{};             // NOLINT
+  Voltages active_{};             // NOLINT
+  Voltages eoc_{};                // NOLINT
+  mutable int duration_reads_{};  // NOLINT
+};
+
+using Engine =
+    dhe::envelope::stage::PolyEngine<float_4, Signals, channel_count>;
+
+template <typename Run> auto test(Run run) -> TestFunc {
+  return [run](Tester &t) {
+    Signals signals{};
+    Engine engine{signals};
+    engine.on_sample_rate_change(sample_time);
+    run(t, signals, engine);
+  };
+}
+
+class StagePolyEngineSuite : Suite {
+public:
+  StagePolyEngineSuite() : Suite{"dhe::envelope::stage::PolyEngine"} {}
+
+  void run(Tester &t) override {
+    t.run("sends each channel's input while in input mode",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            for (auto c = 0; c < channel_count; c++) {
+              signals.input_[c] = static_cast<float>(c);
+            }
+
+            engine.process(channel_count, sample_time);
+
+            for (auto c = 0; c < channel_count; c++) {
+              assert_that(t, signals.output_[c],
+                          is_equal_to(static_cast<float>(c)));
+            }
+          }));
+
+    t.run("generates only on the channels whose gates rise",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.input_.fill(2.F);
+            signals.trigger_[1] = 10.F;
+            signals.trigger_[6] = 10.F;
+
+            engine.process(channel_count, sample_time);
+
+            for (auto c = 0; c < channel_count; c++) {
+              auto const rose = c == 1 || c == 6;
+              assert_that(t, "active", signals.is_active(c), is_equal_to(rose));
+              if (rose) {
+                assert_that(t, "generated", 2.F,
+                            is_less_than(signals.output_[c]));
+              } else {
+                assert_that(t, "input", signals.output_[c], is_equal_to(2.F));
+              }
+            }
+          }));
+
+    t.run("a deferring channel sends its input and is active",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.input_[2] = 3.F;
+            signals.trigger_[2] = 10.F;
+            signals.defer_[2] = 10.F;
+
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "out", signals.output_[2], is_equal_to(3.F));
+            assert_that(t, "active", signals.is_active(2), is_true);
+          }));
+
+    t.run("a completed curve sends the level and raises EOC for 1ms",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.duration_[3] = 2.5e-3F;
+            signals.trigger_[3] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[3] = 10.F;
+
+            // Generates for 2.5ms, then starts EOC 0.5ms into the 3rd sample
+            for (auto i = 0; i < 3; i++) {
+              engine.process(channel_count, sample_time);
+            }
+            assert_that(t, "out at end", signals.output_[3],
+                        is_equal_to(10.F));
+            assert_that(t, "active at end", signals.is_active(3), is_false);
+            assert_that(t, "eoc at end", signals.is_eoc(3), is_true);
+
+            signals.level_[3] = 7.F;
+            engine.process(channel_count, sample_time); // EOC ran 1.5ms
+
+            assert_that(t, "out in level mode", signals.output_[3],
+                        is_equal_to(7.F));
+            assert_that(t, "eoc after 1.5ms", signals.is_eoc(3), is_false);
+          }));
+
+    t.run("a curve starts where the trigger crossed the threshold",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.curvature_.fill(0.F); // Linear
+            signals.trigger_[0] = 0.F;
+            signals.trigger_[4] = 1.F;
+            engine.process(channel_count, sample_time);
+
+            // Rising from 0V to 4V crosses 1V a quarter of the way through the
+            // sample
+            signals.trigger_[0] = 4.F;
+            // Rising from 1V crosses 1V at the start of the sample
+            signals.trigger_[4] = 4.F;
+            engine.process(channel_count, sample_time);
+
+            // 0.75ms into a 10ms curve to 10V
+            assert_that(t, "crossed late", signals.output_[0],
+                        is_near(0.75F, 1e-5F));
+            // 1ms into a 10ms curve to 10V
+            assert_that(t, "crossed early", signals.output_[4],
+                        is_near(1.F, 1e-5F));
+          }));
+
+    t.run("a latched curve keeps the level it read when its gate rose",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.curvature_.fill(0.F); // Linear
+            signals.latches_curve_ = true;
+            signals.trigger_[5] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[5] = 10.F;
+            engine.process(channel_count, sample_time); // 1ms into 10ms curve
+
+            signals.latches_curve_ = false;
+            signals.level_[5] = 0.F;
+            engine.process(channel_count, sample_time); // 2ms into 10ms curve
+
+            assert_that(t, signals.output_[5], is_near(2.F, 1e-5F));
+          }));
+
+    t.run("a latched curve reads its signals only when its gate rises",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.latches_curve_ = true;
+            signals.trigger_[5] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[5] = 10.F;
+            engine.process(channel_count, sample_time); // Rise: reads curve
+            auto const reads_at_rise = signals.duration_reads_;
+
+            engine.process(channel_count, sample_time);
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "active", signals.is_active(5), is_true);
+            assert_that(t, "reads after rise", signals.duration_reads_,
+                        is_equal_to(reads_at_rise));
+          }));
+
+    t.run("an S-shaped curve is symmetric about its midpoint",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.curvature_.fill(0.5F);
+            signals.shape_ = Shape::Id::S;
+            signals.trigger_[7] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[7] = 10.F;
+
+            for (auto i = 0; i < 5; i++) {
+              engine.process(channel_count, sample_time);
+            }
+
+            // Halfway through the curve from 0V to 10V
+            assert_that(t, signals.output_[7], is_near(5.F, 1e-5F));
+          }));
+
+    t.run("sleeps in input mode while its inputs are constant",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.input_.fill(3.F);
+            engine.process(channel_count, sample_time);
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "asleep", engine.is_asleep(4), is_true);
+            assert_that(t, "out", signals.output_[5], is_equal_to(3.F));
+          }));
+
+    t.run("a sleeping channel in input mode sends its new input",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.input_[2] = 5.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, signals.output_[2], is_equal_to(5.F));
+          }));
+
+    t.run("sleeps in level mode after the EOC pulse ends",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.duration_[1] = 1e-3F;
+            signals.trigger_[1] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[1] = 10.F;
+            engine.process(channel_count, sample_time); // Completes, EOC rises
+            assert_that(t, "asleep during EOC", engine.is_asleep(0), is_false);
+
+            engine.process(channel_count, sample_time); // EOC ends
+
+            assert_that(t, "asleep", engine.is_asleep(0), is_true);
+            assert_that(t, "out", signals.output_[1], is_equal_to(10.F));
+            assert_that(t, "eoc", signals.is_eoc(1), is_false);
+          }));
+
+    t.run("a sleeping channel in level mode sends its new level",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.duration_[1] = 1e-3F;
+            signals.trigger_[1] = 1.F;
+            engine.process(channel_count, sample_time);
+            signals.trigger_[1] = 10.F;
+            engine.process(channel_count, sample_time); // Completes
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.level_[1] = 4.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, signals.output_[1], is_equal_to(4.F));
+          }));
+
+    t.run("a sleeping channel wakes and generates when its gate rises",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            signals.trigger_[6] = 1.F;
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.trigger_[6] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "asleep", engine.is_asleep(4), is_false);
+            assert_that(t, "active", signals.is_active(6), is_true);
+            assert_that(t, "generated", 0.F, is_less_than(signals.output_[6]));
+          }));
+
+    t.run("a sleeping channel wakes and defers when defer rises",
+          test([](Tester &t, Signals &signals, Engine &engine) {
+            engine.process(channel_count, sample_time); // Falls asleep
+
+            signals.input_[3] = 2.F;
+            signals.defer_[3] = 10.F;
+            engine.process(channel_count, sample_time);
+
+            assert_that(t, "active", signals.is_active(3), is_true);
+            assert_that(t, "out", signals.output_[3], is_equal_to(2.F));
+          }));
+  }
+};
+
+static auto _ = StagePolyEngineSuite{};
+} // namespace poly
+} // namespace stage
+} // namespace test
@@ -0,0 +1,158 @@
+#include "modules/func/engine.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+#include <array>
+
+namespace test {
+namespace func {
+using dhe::func::FuncEngine;
+using dhe::func::MultiplierRangeId;
+using dhe::func::OffsetRangeId;
+using dhe::func::Operation;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+
+static auto constexpr channel_count = 2;
+static auto constexpr voice_count = 16;
+
+struct Channel {
+  bool connected_{};                                            // NOLINT
+  int input_voices_{1};                                         // NOLINT
+  std::array<float, voice_count> input_{};                      // NOLINT
+  float operand_{0.5F};                                         // NOLINT
+  Operation operation_{Operation::Add};                         // NOLINT
+  OffsetRangeId offset_range_{OffsetRangeId::Bipolar};          // NOLINT
+  MultiplierRangeId multiplier_range_{MultiplierRangeId::Gain}; // NOLINT
+  int output_voices_{};                                         // NOLINT
+  std::array<float, voice_count> output_{};                     // NOLINT
+};
+
+struct Signals {
+  using Lane = float;
+  static auto constexpr lane_size = 1;
+  static auto constexpr channel_count = test::func::channel_count;
+
+  auto input(int channel, int lane) const -> float {
+    return channels_[channel].input_[lane];
+  }
+  auto is_connected(int channel) const -> bool {
+    return channels_[channel].connected_;
+  }
+  auto multiplier_range(int channel) const -> MultiplierRangeId {
+    return channels_[channel].multiplier_range_;
+  }
+  auto offset_range(int channel) const -> OffsetRangeId {
+    return channels_[channel].offset_range_;
+  }
+  auto operand(int channel) const -> float {
+    return channels_[channel].operand_;
+  }
+  auto operation(int channel) const -> Operation {
+    return channels_[channel].operation_;
+  }
+  void output(int channel, int lane, float voltage) {
+    channels_[channel].output_[lane] = voltage;
+  }
+  void set_voice_count(int channel, int voices) {
+    channels_[channel].output_voices_ = voices;
+  }
+  auto voice_count(int channel) const -> int {
+    return channels_[channel].input_voices_;
+  }
+
+  std::array<Channel, channel_count> channels_{}; // NOLINT
+};
+
+using Engine = FuncEngine<Signals>;
+
+static inline void apply_all(Engine &engine) {
+  auto upstream = Engine::UpstreamVoltages{};
+  for (auto channel = 0; channel < channel_count; channel++) {
+    engine.apply(channel, upstream);
+  }
+}
+
+class FuncEngineSuite : public Suite {
+public:
+  FuncEngineSuite() : Suite{"dhe::func::FuncEngine"} {}
+
+  void run(Tester &t) override {
+    t.run("applies the operation to each input voice", [](Tester &t) {
+      auto signals = Signals{};
+      auto engine = Engine{signals};
+      auto &channel = signals.channels_[0];
+      channel.connected_ = true;
+      channel.input_voices_ = 3;
+      channel.input_ = {1.F, 2.F, 3.F};
+      channel.operation_ = Operation::Multiply;
+      channel.operand_ = 1.F; // 2x with the gain range
+
+      apply_all(engine);
+
+      assert_that(t, "voices", channel.output_voices_, is_equal_to(3));
+      assert_that(t, "voice 0", channel.output_[0], is_equal_to(2.F));
+      assert_that(t, "voice 1", channel.output_[1], is_equal_to(4.F));
+      assert_that(t, "voice 2", channel.output_[2], is_equal_to(6.F));
+    });
+
+    t.run("disconnected input carries every upstream voice", [](Tester &t) {
+      auto signals = Signals{};
+      auto engine = Engine{signals};
+      auto &first = signals.channels_[0];
+      first.connected_ = true;
+      first.input_voices_ = 2;
+      first.input_ = {1.F, 2.F};
+      first.operand_ = 0.5F; // Add 0V with the bipolar range
+      auto &second = signals.channels_[1];
+      second.connected_ = false;
+      second.operand_ = 1.F; // Add 5V with the bipolar range
+
+      apply_all(engine);
+
+      assert_that(t, "voices", second.output_voices_, is_equal_to(2));
+      assert_that(t, "voice 0", second.output_[0], is_equal_to(6.F));
+      assert_that(t, "voice 1", second.output_[1], is_equal_to(7.F));
+    });
+
+    t.run("follows changes to the channel's controls", [](Tester &t) {
+      auto signals = Signals{};
+      auto engine = Engine{signals};
+      auto &channel = signals.channels_[0];
+      channel.connected_ = true;
+      channel.input_ = {3.F};
+      channel.operand_ = 1.F; // Add 5V with the bipolar range
+      apply_all(engine);
+
+      channel.operation_ = Operation::Multiply; // 2x with the gain range
+      apply_all(engine);
+
+      assert_that(t, "multiplied", channel.output_[0], is_equal_to(6.F));
+
+      channel.multiplier_range_ = MultiplierRangeId::Attenuator; // 1x
+      apply_all(engine);
+
+      assert_that(t, "attenuated", channel.output_[0], is_equal_to(3.F));
+    });
+
+    t.run("first channel without input operates on one 0V voice",
+          [](Tester &t) {
+            auto signals = Signals{};
+            auto engine = Engine{signals};
+            auto &channel = signals.channels_[0];
+            channel.connected_ = false;
+            channel.operand_ = 1.F; // Add 5V with the bipolar range
+
+            apply_all(engine);
+
+            assert_that(t, "voices", channel.output_voices_, is_equal_to(1));
+            assert_that(t, "voice 0", channel.output_[0], is_equal_to(5.F));
+          });
+  }
+};
+
+static auto _ = FuncEngineSuite{};
+} // namespace func
+} // namespace test
@@ -0,0 +1,111 @@
+#include "modules/fuzzy-logic/engines.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace test {
+namespace fuzzy_logic {
+using dhe::fuzzy_logic::EEngine;
+using dhe::fuzzy_logic::HEngine;
+using dhe::fuzzy_logic::HpEngine;
+using dhe::fuzzy_logic::LEngine;
+using dhe::fuzzy_logic::ZEngine;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+
+using Connective = std::function<float(float, float)>;
+
+struct Family {
+  std::string name_;       // NOLINT
+  Connective conjunction_; // NOLINT
+  Connective disjunction_; // NOLINT
+  Connective implication_; // NOLINT
+  float mid_and_;          // NOLINT
+  float mid_or_;           // NOLINT
+};
+
+template <typename Engine>
+auto family(std::string const &name, float mid_and, float mid_or) -> Family {
+  return Family{
+      name,
+      [](float a, float b) { return Engine::conjunction(a, b); },
+      [](float a, float b) { return Engine::disjunction(a, b); },
+      [](float a, float b) { return Engine::implication(a, b); },
+      mid_and,
+      mid_or,
+  };
+}
+
+static auto const families = std::vector<Family>{
+    family<HEngine>("product", 2.5F, 7.5F),
+    family<ZEngine>("min/max", 5.F, 5.F),
+    family<LEngine>("Lukasiewicz", 0.F, 10.F),
+    family<HpEngine>("Hamacher", 10.F / 3.F, 20.F / 3.F),
+    family<EEngine>("Einstein", 2.F, 8.F),
+};
+
+static auto constexpr tolerance = 1e-4F;
+static auto const truths = std::vector<float>{0.F, 2.F, 5.F, 7.F, 10.F};
+
+class FuzzyLogicEnginesSuite : public Suite {
+public:
+  FuzzyLogicEnginesSuite() : Suite{"dhe::fuzzy_logic engines"} {}
+
+  void run(Tester &t) override {
+    for (auto const &f : families) {
+      t.run(f.name_, [f](Tester &t) {
+        t.run("agrees with classical logic", [f](Tester &t) {
+          for (auto a : {0.F, 10.F}) {
+            for (auto b : {0.F, 10.F}) {
+              auto const want_and = a > 0.F && b > 0.F ? 10.F : 0.F;
+              auto const want_or = a > 0.F || b > 0.F ? 10.F : 0.F;
+              auto const want_implies = a == 0.F || b > 0.F ? 10.F : 0.F;
+              assert_that(t, "and", f.conjunction_(a, b),
+                          is_near(want_and, tolerance));
+              assert_that(t, "or", f.disjunction_(a, b),
+                          is_near(want_or, tolerance));
+              assert_that(t, "implies", f.implication_(a, b),
+                          is_near(want_implies, tolerance));
+            }
+          }
+        });
+
+        t.run("10 is the identity of and", [f](Tester &t) {
+          for (auto a : truths) {
+            assert_that(t, f.conjunction_(a, 10.F), is_near(a, tolerance));
+          }
+        });
+
+        t.run("0 is the identity of or", [f](Tester &t) {
+          for (auto a : truths) {
+            assert_that(t, f.disjunction_(a, 0.F), is_near(a, tolerance));
+          }
+        });
+
+        t.run("or is the De Morgan dual of and", [f](Tester &t) {
+          for (auto a : truths) {
+            for (auto b : truths) {
+              auto const dual = 10.F - f.conjunction_(10.F - a, 10.F - b);
+              assert_that(t, f.disjunction_(a, b), is_near(dual, tolerance));
+            }
+          }
+        });
+
+        t.run("midpoint", [f](Tester &t) {
+          assert_that(t, "and", f.conjunction_(5.F, 5.F),
+                      is_near(f.mid_and_, tolerance));
+          assert_that(t, "or", f.disjunction_(5.F, 5.F),
+                      is_near(f.mid_or_, tolerance));
+        });
+      });
+    }
+  }
+};
+
+static auto _ = FuzzyLogicEnginesSuite{};
+} // namespace fuzzy_logic
+} // namespace test
@@ -0,0 +1,107 @@
+#include "modules/gator/gates.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+#include <string>
+#include <vector>
+
+namespace test {
+namespace gator {
+using dhe::gator::gate_outputs;
+using dhe::gator::GateTable;
+using dhe::gator::HighInputs;
+using dhe::gator::OutputId;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+
+static inline auto bit(int output_id) -> unsigned int {
+  return 1U << output_id;
+}
+
+struct GateOutputsTest {
+  std::string name_;    // NOLINT
+  int high_count_;      // NOLINT
+  int connected_count_; // NOLINT
+  unsigned int want_;   // NOLINT
+};
+
+static auto const gate_outputs_tests = std::vector<GateOutputsTest>{
+    {"no inputs connected", 0, 0, 0U},
+    {"none of 3 high", 0, 3,
+     bit(OutputId::Nand) | bit(OutputId::Nor) | bit(OutputId::Even) |
+         bit(OutputId::Xnor)},
+    {"1 of 3 high", 1, 3,
+     bit(OutputId::Nand) | bit(OutputId::Or) | bit(OutputId::Odd) |
+         bit(OutputId::Xor)},
+    {"2 of 3 high", 2, 3,
+     bit(OutputId::Nand) | bit(OutputId::Or) | bit(OutputId::Even) |
+         bit(OutputId::Xnor)},
+    {"3 of 3 high", 3, 3,
+     bit(OutputId::And) | bit(OutputId::Or) | bit(OutputId::Odd) |
+         bit(OutputId::Xnor)},
+};
+
+class GatesSuite : public Suite {
+public:
+  GatesSuite() : Suite{"dhe::gator gates"} {}
+
+  void run(Tester &t) override {
+    for (auto const &test : gate_outputs_tests) {
+      t.run("gate_outputs: " + test.name_, [test](Tester &t) {
+        assert_that(t, gate_outputs(test.high_count_, test.connected_count_),
+                    is_equal_to(test.want_));
+      });
+    }
+
+    t.run("HighInputs: records each lane's high bit in its channel",
+          [](Tester &t) {
+            auto high_inputs = HighInputs{};
+            high_inputs.add(3, 4, 0x5U); // Input 3 high in channels 4 and 6
+            high_inputs.add(9, 4, 0x4U); // Input 9 high in channel 6
+
+            assert_that(t, "channel 4", high_inputs.count(4), is_equal_to(1));
+            assert_that(t, "channel 5", high_inputs.count(5), is_equal_to(0));
+            assert_that(t, "channel 6", high_inputs.count(6), is_equal_to(2));
+            assert_that(t, "channel 7", high_inputs.count(7), is_equal_to(0));
+          });
+
+    t.run("HighInputs: clear lowers every input in every channel",
+          [](Tester &t) {
+            auto high_inputs = HighInputs{};
+            high_inputs.add(0, 12, 0xFU);
+
+            high_inputs.clear();
+
+            for (auto c = 0; c < HighInputs::max_channels; c++) {
+              assert_that(t, high_inputs.count(c), is_equal_to(0));
+            }
+          });
+
+    t.run("GateTable: looks up the gates for the connected inputs",
+          [](Tester &t) {
+            auto table = GateTable{};
+            table.connect(0x8001U); // Inputs 0 and 15
+
+            for (auto high_count = 0; high_count <= 2; high_count++) {
+              assert_that(t, table.outputs(high_count),
+                          is_equal_to(gate_outputs(high_count, 2)));
+            }
+          });
+
+    t.run("GateTable: rebuilds when the connected inputs change",
+          [](Tester &t) {
+            auto table = GateTable{};
+            table.connect(0x3U);
+
+            table.connect(0x7U);
+
+            assert_that(t, table.outputs(3), is_equal_to(gate_outputs(3, 3)));
+          });
+  }
+};
+
+static auto _ = GatesSuite{};
+} // namespace gator
+} // namespace test
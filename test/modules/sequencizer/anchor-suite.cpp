@@ -139,6 +139,85 @@ public:
       test.run(t, AnchorType::Start);
       test.run(t, AnchorType::End);
     }
+
+    t.run("is_sampled() reports the current anchor mode", [](Tester &t) {
+      auto constexpr step = 3;
+      auto signals = Signals{};
+      auto anchor = Anchor<Signals>{signals, AnchorType::End};
+
+      signals.set(AnchorType::End, step, AnchorMode::Sample,
+                  AnchorSource::InA, 1.F);
+      anchor.enter(step);
+      assert_that(t, "after entering sampled", anchor.is_sampled(), is_true);
+
+      signals.set(AnchorType::End, step, AnchorMode::Track, AnchorSource::InA,
+                  1.F);
+      assert_that(t, "after switching to track", anchor.is_sampled(),
+                  is_false);
+    });
+
+    t.run("voltage() follows a mid-step switch from Sample to Track",
+          [](Tester &t) {
+            auto constexpr step = 4;
+            auto signals = Signals{};
+            auto anchor = Anchor<Signals>{signals, AnchorType::Start};
+
+            signals.set(AnchorType::Start, step, AnchorMode::Sample,
+                        AnchorSource::InC, 1.F);
+            anchor.enter(step);
+            signals.set(AnchorType::Start, step, AnchorMode::Track,
+                        AnchorSource::InC, 6.F);
+
+            assert_that(t, anchor.voltage(), is_equal_to(6.F));
+          });
+
+    t.run("voltage() after a mid-step switch from Track to Sample is the "
+          "voltage on entry",
+          [](Tester &t) {
+            auto constexpr step = 5;
+            auto signals = Signals{};
+            auto anchor = Anchor<Signals>{signals, AnchorType::End};
+
+            signals.set(AnchorType::End, step, AnchorMode::Track,
+                        AnchorSource::InB, 1.F);
+            anchor.enter(step);
+            signals.set(AnchorType::End, step, AnchorMode::Sample,
+                        AnchorSource::InB, 6.F);
+
+            assert_that(t, anchor.voltage(), is_equal_to(1.F));
+          });
+
+    t.run("AnchorMode::Track voltage() reads a new source after refresh()",
+          [](Tester &t) {
+            auto constexpr step = 6;
+            auto signals = Signals{};
+            auto anchor = Anchor<Signals>{signals, AnchorType::Start};
+
+            signals.set(AnchorType::Start, step, AnchorMode::Track,
+                        AnchorSource::InA, 1.F);
+            anchor.enter(step);
+            signals.set(AnchorType::Start, step, AnchorMode::Track,
+                        AnchorSource::InC, 6.F);
+
+            anchor.refresh();
+
+            assert_that(t, anchor.voltage(), is_equal_to(6.F));
+          });
+
+    t.run("AnchorMode::Track voltage() is current source voltage",
+          [](Tester &t) {
+            auto constexpr step = 2;
+            auto signals = Signals{};
+            auto anchor = Anchor<Signals>{signals, AnchorType::Start};
+
+            signals.set(AnchorType::Start, step, AnchorMode::Track,
+                        AnchorSource::InB, 1.F);
+            anchor.enter(step);
+            signals.set(AnchorType::Start, step, AnchorMode::Track,
+                        AnchorSource::InB, 6.F);
+
+            assert_that(t, anchor.voltage(), is_equal_to(6.F));
+          });
   }
 };
 /**
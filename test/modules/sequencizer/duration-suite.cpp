@@ -54,6 +54,7 @@ struct DurationRangeTest {
       params[ParamId::DurationRange].setValue(static_cast<float>(range_id));
       params[ParamId::DurationMultiplier].setValue(multiplier_rotation);
       inputs[InputId::DurationMultiplierCV].setVoltage(multiplier_cv);
+      params[ParamId::AudioRate].setValue(0.F);
 
       auto const duration = signals.duration(step);
       assert_that(t, duration, is_near(want, tolerance));
@@ -256,6 +257,27 @@ struct DurationSuite : Suite {
     short_duration_tests.run(t);
     medium_duration_tests.run(t);
     long_duration_tests.run(t);
+
+    t.run("at audio rate: permits durations below the range minimum",
+          [](Tester &t) {
+            std::vector<Param> params{ParamId::Count};
+            std::vector<Port> inputs{InputId::Count};
+            std::vector<Port> outputs{OutputId::Count};
+            std::vector<Light> lights{LightId::Count};
+
+            auto constexpr step = 3;
+            auto const signals =
+                dhe::sequencizer::Signals<Param, Port, Port, Light, N>{
+                    inputs, params, outputs, lights};
+            params[ParamId::StepDuration + step].setValue(0.F);
+            params[ParamId::DurationRange].setValue(
+                static_cast<float>(DurationRangeId::Short));
+            params[ParamId::DurationMultiplier].setValue(0.25F); // 0.5x
+            inputs[InputId::DurationMultiplierCV].setVoltage(0.F);
+            params[ParamId::AudioRate].setValue(1.F);
+
+            assert_that(t, signals.duration(step), is_near(0.5e-3F, 1e-6F));
+          });
   }
 };
 
@@ -21,9 +21,11 @@ using TestFunc = std::function<void(Tester &)>;
 auto constexpr step_count = 8;
 struct Anchor {
   void enter(int step) { entered_[step] = true; }
+  auto is_sampled() const -> bool { return is_sampled_; }
   auto voltage() const -> float { return voltage_; }
 
   std::array<bool, step_count> entered_{}; // NOLINT
+  bool is_sampled_{};                      // NOLINT
   float voltage_{};                        // NOLINT
 };
 
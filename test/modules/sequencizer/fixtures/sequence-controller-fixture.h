@@ -8,6 +8,7 @@
 
 #include <array>
 #include <functional>
+#include <map>
 
 namespace test {
 namespace sequencizer {
@@ -20,41 +21,54 @@ using TestFunc = std::function<void(Tester &)>;
 auto constexpr step_count = 8;
 
 struct Signals {
+  auto duration(int step) const -> float { return duration_[step]; }
   auto gate() const -> bool { return gate_; }
+  auto gate_voltage() const -> float { return gate_voltage_; }
+  auto has_position() const -> bool { return has_position_; }
+  auto is_audio_rate() const -> bool { return audio_rate_; }
   auto is_looping() const -> bool { return looping_; }
   auto is_reset() const -> bool { return reset_; }
   auto is_running() const -> bool { return running_; }
   auto input() const -> float { return in_a_; }
   void output(float v) { output_ = v; }
+  auto position() const -> float { return position_; }
   void show_sequence_event(bool /**/) {}
   void show_step_event(bool /**/) {}
   void show_step_status(int step, StepStatus status) {
     step_ = step, status_ = status;
   }
-  bool gate_{};         // NOLINT
-  float in_a_{};        // NOLINT
-  bool looping_{};      // NOLINT
-  float output_{};      // NOLINT
-  bool reset_{};        // NOLINT
-  bool running_{};      // NOLINT
-  StepStatus status_{}; // NOLINT
-  int step_{};          // NOLINT
+  bool audio_rate_{};                        // NOLINT
+  std::array<float, step_count> duration_{}; // NOLINT
+  float gate_voltage_{};                     // NOLINT
+  bool gate_{};                              // NOLINT
+  bool has_position_{};                      // NOLINT
+  float in_a_{};                             // NOLINT
+  bool looping_{};                           // NOLINT
+  float output_{};                           // NOLINT
+  float position_{};                         // NOLINT
+  bool reset_{};                             // NOLINT
+  bool running_{};                           // NOLINT
+  StepStatus status_{};                      // NOLINT
+  int step_{};                               // NOLINT
 };
 
 struct StepController {
-  void enter(int step) {
+  void enter(int step, float phase = 0.F) {
     called_ = true;
     entered_ = true;
     entered_step_ = step;
+    entered_phase_ = phase;
   }
   auto execute(Latch &latch, float sample_time) -> StepStatus {
     called_ = true;
     executed_ = true;
+    execute_count_++;
     executed_latch_ = latch;
     executed_sample_time_ = sample_time;
     return status_;
   }
   void exit() { exited_ = true; }
+  auto leftover_time() const -> float { return leftover_time_; }
   bool called_{};                // NOLINT
   bool entered_{};               // NOLINT
   StepStatus status_{};          // NOLINT
@@ -63,6 +77,9 @@ struct StepController {
   Latch executed_latch_{};       // NOLINT
   float executed_sample_time_{}; // NOLINT
   int entered_step_{};           // NOLINT
+  float entered_phase_{};        // NOLINT
+  int execute_count_{};          // NOLINT
+  float leftover_time_{};        // NOLINT
 };
 
 struct StepSelector {
@@ -73,12 +90,14 @@ struct StepSelector {
   auto successor(int step) -> int {
     called_ = true;
     step_ = step;
-    return successor_;
+    auto const found = successors_.find(step);
+    return found == successors_.end() ? successor_ : found->second;
   }
-  bool called_{};   // NOLINT
-  int first_{};     // NOLINT
-  int step_{};      // NOLINT
-  int successor_{}; // NOLINT
+  bool called_{};                   // NOLINT
+  int first_{};                     // NOLINT
+  int step_{};                      // NOLINT
+  int successor_{};                 // NOLINT
+  std::map<int, int> successors_{}; // NOLINT
 };
 
 using SequenceController =
@@ -19,14 +19,20 @@ using TestFunc = std::function<void(Tester &)>;
 auto constexpr step_count = 8;
 
 struct Generator {
-  void start(int step) { started_step_ = step; }
+  void start(int step, float phase = 0.F) {
+    started_step_ = step;
+    started_phase_ = phase;
+  }
   void stop() { stopped_ = true; }
+  auto leftover_time() const -> float { return leftover_time_; }
   auto generate(float sample_time) -> GeneratorStatus {
     sample_time_ = sample_time;
     return status_[started_step_];
   }
 
   int started_step_ = -3;                            // NOLINT
+  float started_phase_ = -1.F;                       // NOLINT
+  float leftover_time_ = 0.F;                        // NOLINT
   float sample_time_ = -9.F;                         // NOLINT
   bool stopped_ = false;                             // NOLINT
   std::array<GeneratorStatus, step_count> status_{}; // NOLINT
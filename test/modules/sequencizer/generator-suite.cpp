@@ -48,6 +48,25 @@ public:
                         is_equal_to(0.F));
           }));
 
+    t.run("start(s, p) shows progress at p",
+          test([](Tester &t, Signals &module, Anchor & /*start_anchor*/,
+                  Anchor & /*end_source*/, Generator &generator) {
+            auto constexpr step = 5;
+            auto constexpr phase = 0.625F;
+            module.shape_[step] = Shape::Id::J;
+            module.duration_[step] = 10.F;
+
+            generator.start(step, phase);
+
+            assert_that(t, "at start", module.progress_[step],
+                        is_equal_to(phase));
+
+            generator.generate(1.F); // Advance by 0.1 of the duration
+
+            assert_that(t, "after generate", module.progress_[step],
+                        is_equal_to(phase + 0.1F));
+          }));
+
     t.run("stop()",
           test([](Tester &t, Signals &module, Anchor & /*start_anchor*/,
                   Anchor & /*end_anchor*/, Generator &generator) {
@@ -91,6 +110,67 @@ public:
             assert_that(t, module.output_, is_equal_to(scaled_tapered_phase));
           }));
 
+    t.run("generate(t) with sampled anchors uses voltages from entry",
+          test([](Tester &t, Signals &module, Anchor &start_anchor,
+                  Anchor &end_anchor, Generator &generator) {
+            auto constexpr step = 6;
+            module.shape_[step] = Shape::Id::J;
+            module.duration_[step] = 1.F;
+            start_anchor.is_sampled_ = true;
+            end_anchor.is_sampled_ = true;
+            start_anchor.voltage_ = 2.F;
+            end_anchor.voltage_ = 4.F;
+
+            generator.start(step);
+            start_anchor.voltage_ = -99.F;
+            end_anchor.voltage_ = 99.F;
+
+            generator.generate(0.5F);
+
+            assert_that(t, module.output_, is_equal_to(3.F));
+          }));
+
+    t.run("generate(t) with a tracking anchor uses current voltages",
+          test([](Tester &t, Signals &module, Anchor &start_anchor,
+                  Anchor &end_anchor, Generator &generator) {
+            auto constexpr step = 1;
+            module.shape_[step] = Shape::Id::J;
+            module.duration_[step] = 1.F;
+            start_anchor.is_sampled_ = true;
+            end_anchor.is_sampled_ = false;
+            start_anchor.voltage_ = 2.F;
+            end_anchor.voltage_ = 4.F;
+
+            generator.start(step);
+            start_anchor.voltage_ = 6.F;
+            end_anchor.voltage_ = 8.F;
+
+            generator.generate(0.5F);
+
+            assert_that(t, module.output_, is_equal_to(7.F));
+          }));
+
+    t.run("generate(t) follows an anchor that switches to tracking mid-step",
+          test([](Tester &t, Signals &module, Anchor &start_anchor,
+                  Anchor &end_anchor, Generator &generator) {
+            auto constexpr step = 3;
+            module.shape_[step] = Shape::Id::J;
+            module.duration_[step] = 1.F;
+            start_anchor.is_sampled_ = true;
+            end_anchor.is_sampled_ = true;
+            start_anchor.voltage_ = 2.F;
+            end_anchor.voltage_ = 4.F;
+
+            generator.start(step);
+            end_anchor.is_sampled_ = false;
+            start_anchor.voltage_ = 6.F;
+            end_anchor.voltage_ = 8.F;
+
+            generator.generate(0.5F);
+
+            assert_that(t, module.output_, is_equal_to(7.F));
+          }));
+
     t.run("generate(t) reports progress",
           test([](Tester &t, Signals &module, Anchor & /*start_anchor*/,
                   Anchor & /*end_anchor*/, Generator &generator) {
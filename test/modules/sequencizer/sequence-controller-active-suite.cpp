@@ -130,6 +130,69 @@ public:
                              is_equal_to(StepStatus::Generating));
                }));
 
+    t.run("if active step completes: "
+          "at audio rate: "
+          "spends leftover time on successors in the same sample",
+          test(when_active,
+               [](Tester &t, Signals &signals, StepSelector &step_selector,
+                  StepController &step_controller,
+                  SequenceController &sequence_controller) {
+                 signals.running_ = true;
+                 signals.audio_rate_ = true;
+
+                 step_controller.status_ = StepStatus::Idle;
+                 step_controller.leftover_time_ = 0.001F;
+                 step_selector.successors_[initially_active_step] = 4;
+                 step_selector.successors_[4] = -1;
+
+                 sequence_controller.execute(0.F);
+                 assert_that(t, "executions", step_controller.execute_count_,
+                             is_equal_to(2));
+                 assert_that(t, "step status step", signals.step_,
+                             is_equal_to(-1));
+               }));
+
+    t.run("if active step completes: "
+          "at audio rate: "
+          "limits step transitions per sample",
+          test(when_active,
+               [](Tester &t, Signals &signals, StepSelector &step_selector,
+                  StepController &step_controller,
+                  SequenceController &sequence_controller) {
+                 signals.running_ = true;
+                 signals.audio_rate_ = true;
+                 signals.looping_ = true;
+
+                 step_controller.status_ = StepStatus::Idle;
+                 step_controller.leftover_time_ = 0.001F;
+                 step_selector.successor_ = initially_active_step;
+
+                 sequence_controller.execute(0.F);
+                 assert_that(t, "executions", step_controller.execute_count_,
+                             is_equal_to(65));
+               }));
+
+    t.run("if active step completes: "
+          "not at audio rate: "
+          "does not execute successor in the same sample",
+          test(when_active,
+               [](Tester &t, Signals &signals, StepSelector &step_selector,
+                  StepController &step_controller,
+                  SequenceController &sequence_controller) {
+                 signals.running_ = true;
+                 signals.audio_rate_ = false;
+
+                 step_controller.status_ = StepStatus::Idle;
+                 step_controller.leftover_time_ = 0.001F;
+                 step_selector.successor_ = initially_active_step + 2;
+
+                 sequence_controller.execute(0.F);
+                 assert_that(t, "executions", step_controller.execute_count_,
+                             is_equal_to(1));
+                 assert_that(t, "step status step", signals.step_,
+                             is_equal_to(initially_active_step + 2));
+               }));
+
     t.run("if active step completes: "
           "if no successor: "
           "if looping: "
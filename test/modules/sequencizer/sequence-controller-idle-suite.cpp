@@ -1,6 +1,7 @@
 #include "components/latch.h"
 #include "fixtures/sequence-controller-fixture.h"
 
+#include <cmath>
 #include <functional>
 
 namespace test {
@@ -102,6 +103,30 @@ public:
                  }
                }));
 
+    t.run("with run high: "
+          "if gate rises: "
+          "executes first step for the portion of the sample after the edge",
+          test(when_idle,
+               [](Tester &t, Signals &signals, StepSelector &step_selector,
+                  StepController &step_controller,
+                  SequenceController &sequence_controller) {
+                 signals.running_ = true;
+                 signals.gate_ = true;
+                 signals.gate_voltage_ = 3.F; // Crossed 1V 1/3 of the way
+
+                 step_selector.first_ = 3;
+                 step_controller.status_ = StepStatus::Generating;
+
+                 auto constexpr sample_time = 0.3F;
+                 sequence_controller.execute(sample_time);
+
+                 auto const want = sample_time * 2.F / 3.F;
+                 auto const got = step_controller.executed_sample_time_;
+                 if (std::abs(got - want) > 1e-6F) {
+                   t.errorf("Executed sample time was {}, want {}", got, want);
+                 }
+               }));
+
     t.run("with run high: "
           "if gate rises: does nothing if no first step",
           test(when_idle, [](Tester &t, Signals &signals,
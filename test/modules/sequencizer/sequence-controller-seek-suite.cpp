@@ -0,0 +1,224 @@
+#include "fixtures/sequence-controller-fixture.h"
+#include "fixtures/status-enums.h"
+#include "helpers/assertions.h"
+
+#include "dheunit/test.h"
+
+#include <functional>
+
+namespace test {
+namespace sequencizer {
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+using test::is_near;
+using test::is_true;
+
+// Selects steps 2, 4, and 5, which last 1s, 2s, and 3s.
+static inline void
+with_selection(Signals &signals, StepSelector &step_selector,
+               StepController & /*step_controller*/,
+               SequenceController & /*sequence_controller*/) {
+  step_selector.first_ = 2;
+  step_selector.successors_ = {{2, 4}, {4, 5}, {5, -1}};
+  signals.duration_[2] = 1.F;
+  signals.duration_[4] = 2.F;
+  signals.duration_[5] = 3.F;
+}
+
+auto constexpr phase_tolerance = 1e-6F;
+
+class SequenceControllerSeekSuite : Suite {
+public:
+  SequenceControllerSeekSuite()
+      : Suite{"dhe::sequencizer::SequenceController: seek"} {}
+
+  void run(Tester &t) override {
+    t.run("seek(p) enters the step that spans the weighted position",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            // 0.4 of 6s is 2.4s, which is 1.4s into step 4
+            sequence_controller.seek(0.4F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(4));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.7F, phase_tolerance));
+            assert_that(t, "step status", signals.status_,
+                        is_equal_to(StepStatus::Generating));
+          }));
+
+    t.run("seek(p) enters the step at the phase of the position",
+          test(with_selection, [](Tester &t, Signals & /*signals*/,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            // 0.625 of 6s is 3.75s, which is 0.75s into step 5
+            sequence_controller.seek(0.625F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.25F, phase_tolerance));
+          }));
+
+    t.run("seek(p) beyond end enters last step at phase 1",
+          test(with_selection, [](Tester &t, Signals & /*signals*/,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            sequence_controller.seek(1.5F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_equal_to(1.F));
+          }));
+
+    t.run("seek(p) enters a step with no duration at phase 1",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.duration_[2] = 0.F;
+            signals.duration_[4] = 0.F;
+            signals.duration_[5] = 0.F;
+
+            sequence_controller.seek(0.F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_equal_to(1.F));
+          }));
+
+    t.run("seek_time(s) enters the step at the phase of the offset",
+          test(with_selection, [](Tester &t, Signals & /*signals*/,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            sequence_controller.seek_time(3.75F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.25F, phase_tolerance));
+          }));
+
+    t.run("seek_time(s) beyond end enters last step at phase 1",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.looping_ = false;
+
+            sequence_controller.seek_time(17.F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_equal_to(1.F));
+          }));
+
+    t.run("seek_time(s) beyond end wraps if looping",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.looping_ = true;
+
+            sequence_controller.seek_time(6.F + 6.F + 0.5F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(2));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.5F, phase_tolerance));
+          }));
+
+    t.run("seek_time(s) before start wraps if looping",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.looping_ = true;
+
+            sequence_controller.seek_time(-1.5F); // 4.5s: 1.5s into step 5
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.5F, phase_tolerance));
+          }));
+
+    t.run("seek(p) exits the active step",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            sequence_controller.seek(0.F);
+            step_controller.exited_ = false;
+
+            sequence_controller.seek(0.9F);
+
+            assert_that(t, "exited", step_controller.exited_, is_true);
+            assert_that(t, "step status step", signals.step_, is_equal_to(5));
+          }));
+
+    t.run("seek(p) idles if no step is selected",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector &step_selector,
+                                  StepController & /*step_controller*/,
+                                  SequenceController &sequence_controller) {
+            step_selector.first_ = -1;
+
+            sequence_controller.seek(0.3F);
+
+            assert_that(t, "step status step", signals.step_, is_equal_to(-1));
+            assert_that(t, "step status", signals.status_,
+                        is_equal_to(StepStatus::Idle));
+          }));
+
+    t.run("if reset rises with position: seeks to position",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.has_position_ = true;
+            signals.position_ = 0.25F; // 1.5s: 0.5s into step 4
+            signals.reset_ = true;
+
+            sequence_controller.execute(0.F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(4));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.25F, phase_tolerance));
+          }));
+
+    t.run("if reset rises with position while stopped: seeks to position",
+          test(with_selection, [](Tester &t, Signals &signals,
+                                  StepSelector & /*step_selector*/,
+                                  StepController &step_controller,
+                                  SequenceController &sequence_controller) {
+            signals.running_ = false;
+            signals.has_position_ = true;
+            signals.position_ = 0.5F; // 3s: 0s into step 5
+            signals.reset_ = true;
+
+            sequence_controller.execute(0.F);
+
+            assert_that(t, "entered step", step_controller.entered_step_,
+                        is_equal_to(5));
+            assert_that(t, "entered phase", step_controller.entered_phase_,
+                        is_near(0.F, phase_tolerance));
+            assert_that(t, "step status", signals.status_,
+                        is_equal_to(StepStatus::Generating));
+          }));
+  }
+};
+
+static auto _ = SequenceControllerSeekSuite{};
+} // namespace sequencizer
+} // namespace test
@@ -27,6 +27,19 @@ public:
             assert_that(t, generator.started_step_, is_equal_to(step));
           }));
 
+    t.run("enter(s, p) starts the generator at phase p",
+          test([](Tester &t, Interrupter & /**/, Generator &generator,
+                  Sustainer /**/, StepController &step_controller) {
+            auto constexpr step = 6;
+            auto constexpr phase = 0.375F;
+
+            step_controller.enter(step, phase);
+
+            assert_that(t, "step", generator.started_step_, is_equal_to(step));
+            assert_that(t, "phase", generator.started_phase_,
+                        is_equal_to(phase));
+          }));
+
     t.run("exit() stops the generator",
           test([](Tester &t, Interrupter & /**/, Generator &generator,
                   Sustainer & /**/, StepController &step_controller) {
@@ -80,6 +93,36 @@ public:
             assert_that(t, "generator.stopped", generator.stopped_, is_true);
           }));
 
+    t.run("execute() reports generator leftover time when step completes",
+          test([](Tester &t, Interrupter & /**/, Generator &generator,
+                  Sustainer &sustainer, StepController &step_controller) {
+            auto constexpr step = 3;
+            auto constexpr leftover_time = 0.0021F;
+            step_controller.enter(step);
+            generator.status_[step] = GeneratorStatus::Completed;
+            generator.leftover_time_ = leftover_time;
+            sustainer.is_done_[step] = true;
+
+            step_controller.execute(Latch{}, 0.F);
+
+            assert_that(t, "leftover time", step_controller.leftover_time(),
+                        is_equal_to(leftover_time));
+          }));
+
+    t.run("execute() reports no leftover time if interrupted",
+          test([](Tester &t, Interrupter &interrupter, Generator &generator,
+                  Sustainer & /**/, StepController &step_controller) {
+            auto constexpr step = 4;
+            step_controller.enter(step);
+            interrupter.is_interrupted_[step] = true;
+            generator.leftover_time_ = 0.0013F;
+
+            step_controller.execute(Latch{}, 0.F);
+
+            assert_that(t, "leftover time", step_controller.leftover_time(),
+                        is_equal_to(0.F));
+          }));
+
     t.run(
         "execute() remains in progress if sustaining when generator completes",
         test([](Tester &t, Interrupter & /**/, Generator &generator,
@@ -26,6 +26,7 @@ public:
             signals.length_ = 4;
             signals.enabled_[selection_start] = true;
 
+            selector.refresh();
             auto const first = selector.first();
 
             assert_that(t, first, is_equal_to(selection_start));
@@ -40,6 +41,7 @@ public:
             auto constexpr enabled_selected_step = 5;
             signals.enabled_[enabled_selected_step] = true;
 
+            selector.refresh();
             auto const first = selector.first();
             auto const successor = selector.successor(start);
 
@@ -57,10 +59,25 @@ public:
               enabled = false;
             }
 
+            selector.refresh();
             auto const first = selector.first();
 
             assert_that(t, first, is_less_than(0));
           }));
+
+    t.run("reflects changes only after refresh()",
+          test([](Tester &t, Signals &signals, StepSelector &selector) {
+            signals.start_ = 2;
+            signals.length_ = 4;
+            enable_all(signals);
+            selector.refresh();
+
+            signals.enabled_[2] = false;
+            assert_that(t, "before refresh", selector.first(), is_equal_to(2));
+
+            selector.refresh();
+            assert_that(t, "after refresh", selector.first(), is_equal_to(3));
+          }));
   }
 };
 
@@ -82,6 +99,7 @@ public:
 
             signals.enabled_[expected_successor] = true;
 
+            selector.refresh();
             auto const successor = selector.successor(given_step);
 
             assert_that(t, successor, is_equal_to(expected_successor));
@@ -97,6 +115,7 @@ public:
             auto constexpr expected_successor = 1; // Must wrap to find
             signals.enabled_[expected_successor] = true;
 
+            selector.refresh();
             auto const successor = selector.successor(start);
 
             assert_that(t, successor, is_equal_to(expected_successor));
@@ -113,6 +132,7 @@ public:
             auto constexpr end = start + length - 1;
             signals.enabled_[end] = true;
 
+            selector.refresh();
             auto const successor = selector.successor(start);
 
             assert_that(t, successor, is_equal_to(end));
@@ -130,6 +150,7 @@ public:
             auto const only_enabled_step = 6;
             signals.enabled_[only_enabled_step] = true;
 
+            selector.refresh();
             auto const successor = selector.successor(start);
 
             assert_that(t, successor, is_less_than(0));
@@ -147,6 +168,7 @@ public:
             auto const only_enabled_step = 4;
             signals.enabled_[only_enabled_step] = true;
 
+            selector.refresh();
             auto const successor = selector.successor(start);
 
             assert_that(t, successor, is_less_than(0));
@@ -164,6 +186,7 @@ public:
             // Lower than any selected step
             auto constexpr given_step = 3;
 
+            selector.refresh();
             auto const successor = selector.successor(given_step);
 
             assert_that(t, successor, is_less_than(0));
@@ -181,6 +204,7 @@ public:
             // Higher than any selected step
             auto constexpr given_step = 7;
 
+            selector.refresh();
             auto const successor = selector.successor(given_step);
 
             assert_that(t, successor, is_less_than(0));
@@ -198,6 +222,7 @@ public:
             // Above selection end, below selection start
             auto constexpr given_step = 5;
 
+            selector.refresh();
             auto const successor = selector.successor(given_step);
 
             assert_that(t, successor, is_less_than(0));
@@ -215,6 +240,7 @@ public:
             signals.start_ = start;
             signals.length_ = length;
 
+            selector.refresh();
             auto const successor = selector.successor(end);
 
             assert_that(t, successor, is_less_than(0));
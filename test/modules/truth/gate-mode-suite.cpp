@@ -0,0 +1,53 @@
+#include "modules/truth/gate-mode.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+namespace test {
+namespace truth {
+using dhe::truth::ChannelLatches;
+using dhe::truth::GateMode;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+
+// Bit c is channel c. Channel 0 stays low, 1 rises, 2 falls, and 3 stays
+// high.
+static auto constexpr before = 0xCU;
+static auto constexpr after = 0xAU;
+
+class ChannelLatchesSuite : public Suite {
+public:
+  ChannelLatchesSuite() : Suite{"dhe::truth::ChannelLatches"} {}
+
+  void run(Tester &t) override {
+    auto latches = ChannelLatches{};
+    latches.clock(before);
+    latches.clock(after);
+
+    t.run("high", [latches](Tester &t) {
+      assert_that(t, latches.satisfying(GateMode::High), is_equal_to(after));
+    });
+
+    t.run("low", [latches](Tester &t) {
+      assert_that(t, latches.satisfying(GateMode::Low) & 0xFU,
+                  is_equal_to(0x5U));
+    });
+
+    t.run("rise", [latches](Tester &t) {
+      assert_that(t, latches.satisfying(GateMode::Rise), is_equal_to(0x2U));
+    });
+
+    t.run("fall", [latches](Tester &t) {
+      assert_that(t, latches.satisfying(GateMode::Fall), is_equal_to(0x4U));
+    });
+
+    t.run("edge", [latches](Tester &t) {
+      assert_that(t, latches.satisfying(GateMode::Edge), is_equal_to(0x6U));
+    });
+  }
+};
+
+static auto _ = ChannelLatchesSuite{};
+} // namespace truth
+} // namespace test
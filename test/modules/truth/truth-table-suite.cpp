@@ -0,0 +1,135 @@
+#include "modules/truth/truth-table.h"
+
+#include "dheunit/test.h"
+#include "helpers/assertions.h"
+
+#include <array>
+#include <string>
+
+namespace test {
+namespace truth {
+using dhe::truth::Outcome;
+using dhe::truth::TruthTable;
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::is_equal_to;
+using test::is_false;
+using test::is_true;
+
+class TruthTableSuite : public Suite {
+public:
+  TruthTableSuite() : Suite{"dhe::truth::TruthTable"} {}
+
+  void run(Tester &t) override {
+    t.run("rows are false until set", [](Tester &t) {
+      auto const table = TruthTable<2>{};
+      for (auto row = 0; row < TruthTable<2>::rows; row++) {
+        assert_that(t, table.outcome(row, false), is_false);
+        assert_that(t, table.outcome(row, true), is_false);
+      }
+    });
+
+    t.run("outcome of each kind of row", [](Tester &t) {
+      auto table = TruthTable<2>{};
+      table.set(0, Outcome::True);
+      table.set(1, Outcome::False);
+      table.set(2, Outcome::Q);
+      table.set(3, Outcome::QNot);
+
+      assert_that(t, "true row when Q is low", table.outcome(0, false),
+                  is_true);
+      assert_that(t, "true row when Q is high", table.outcome(0, true),
+                  is_true);
+      assert_that(t, "false row when Q is low", table.outcome(1, false),
+                  is_false);
+      assert_that(t, "false row when Q is high", table.outcome(1, true),
+                  is_false);
+      assert_that(t, "Q row when Q is low", table.outcome(2, false),
+                  is_false);
+      assert_that(t, "Q row when Q is high", table.outcome(2, true), is_true);
+      assert_that(t, "¬Q row when Q is low", table.outcome(3, false),
+                  is_true);
+      assert_that(t, "¬Q row when Q is high", table.outcome(3, true),
+                  is_false);
+    });
+
+    t.run("setting a row replaces its outcome", [](Tester &t) {
+      auto table = TruthTable<2>{};
+      table.set(1, Outcome::True);
+      table.set(1, Outcome::Q);
+
+      assert_that(t, table.outcome(1, false), is_false);
+    });
+
+    t.run("holds 64 rows", [](Tester &t) {
+      auto table = TruthTable<6>{};
+      table.set(63, Outcome::True);
+      table.set(32, Outcome::Q);
+
+      assert_that(t, "row 63", table.outcome(63, false), is_true);
+      assert_that(t, "row 32", table.outcome(32, true), is_true);
+      assert_that(t, "row 31", table.outcome(31, true), is_false);
+      assert_that(t, "row 0", table.outcome(0, true), is_false);
+    });
+
+    t.run("evaluates each channel's row and Q", [](Tester &t) {
+      auto table = TruthTable<3>{};
+      table.set(5, Outcome::True);
+      table.set(3, Outcome::QNot);
+      // Channel 0 selects row 5 (ABC = TFT), channel 1 row 3 (FTT), and
+      // channel 2 row 0 (FFF)
+      auto const input_channels = std::array<unsigned int, 3>{1U, 2U};
+      auto const condition_channels = 3U;
+      auto const q_channels = 2U;
+
+      auto const outcomes =
+          table.outcomes(input_channels, condition_channels, q_channels);
+
+      assert_that(t, outcomes & 7U, is_equal_to(1U));
+    });
+
+    t.run("evaluates 16 channels as each channel's row would", [](Tester &t) {
+      auto table = TruthTable<4>{};
+      auto constexpr kinds = std::array<Outcome, 4>{
+          Outcome::True, Outcome::False, Outcome::Q, Outcome::QNot};
+      for (auto row = 0; row < TruthTable<4>::rows; row++) {
+        table.set(row, kinds[(row * 7 + 3) % 4]);
+      }
+      // Channel c selects row c, with Q high on the odd channels
+      auto input_channels = std::array<unsigned int, 4>{};
+      auto condition_channels = 0U;
+      for (auto c = 0U; c < 16U; c++) {
+        for (auto i = 0U; i < 3U; i++) {
+          input_channels[i] |= ((c >> (3U - i)) & 1U) << c;
+        }
+        condition_channels |= (c & 1U) << c;
+      }
+      auto const q_channels = 0xAAAAU;
+
+      auto const outcomes =
+          table.outcomes(input_channels, condition_channels, q_channels);
+
+      for (auto c = 0; c < 16; c++) {
+        auto const q = ((q_channels >> c) & 1U) != 0;
+        auto const want = table.outcome(c, q);
+        assert_that(t, "channel " + std::to_string(c),
+                    ((outcomes >> c) & 1U) != 0, is_equal_to(want));
+      }
+    });
+
+    t.run("setting a row leaves other rows alone", [](Tester &t) {
+      auto table = TruthTable<2>{};
+      table.set(0, Outcome::True);
+      table.set(3, Outcome::True);
+
+      table.set(1, Outcome::False);
+
+      assert_that(t, "row 0", table.outcome(0, false), is_true);
+      assert_that(t, "row 3", table.outcome(3, false), is_true);
+    });
+  }
+};
+
+static auto _ = TruthTableSuite{};
+} // namespace truth
+} // namespace test
@@ -0,0 +1,74 @@
+#include "signals/basic.h"
+
+#include "dheunit/test.h"
+#include "helpers/rack-controls.h"
+#include "helpers/simd.h"
+
+#include <vector>
+
+namespace test {
+namespace signals {
+using dhe::unit::Suite;
+using dhe::unit::Tester;
+using test::fake::float_4;
+using test::fake::Port;
+
+struct ChannelsSuite : Suite {
+  ChannelsSuite() : Suite{"dhe::channel_count()"} {}
+
+  void run(Tester &t) override {
+    t.run("is at least 1", [](Tester &t) {
+      auto inputs = std::vector<Port>{3};
+      for (auto &input : inputs) {
+        input.setChannels(0);
+      }
+
+      auto const got = dhe::channel_count(inputs);
+      if (got != 1) {
+        t.errorf("Got {}, want 1", got);
+      }
+    });
+
+    t.run("is the largest input channel count", [](Tester &t) {
+      auto inputs = std::vector<Port>{3};
+      inputs[0].setChannels(4);
+      inputs[1].setChannels(9);
+      inputs[2].setChannels(1);
+
+      auto const got = dhe::channel_count(inputs);
+      if (got != 9) {
+        t.errorf("Got {}, want 9", got);
+      }
+    });
+
+    t.run("monophonic input sends its voltage to every channel",
+          [](Tester &t) {
+            auto input = Port{};
+            input.setVoltage(3.F);
+
+            auto const got = dhe::voltages_at<float_4>(input, 4);
+            for (auto i = 0; i < float_4::size; i++) {
+              if (got[i] != 3.F) {
+                t.errorf("Got {} in lane {}, want 3", got[i], i);
+              }
+            }
+          });
+
+    t.run("polyphonic input sends each channel its own voltage",
+          [](Tester &t) {
+            auto input = Port{};
+            input.setChannels(8);
+            input.setVoltage(3.F, 0);
+            input.setVoltage(7.F, 7);
+
+            auto const got = dhe::voltages_at<float_4>(input, 4);
+            if (got[3] != 7.F) {
+              t.errorf("Got {} in lane 3, want 7", got[3]);
+            }
+          });
+  }
+};
+
+static auto _ = ChannelsSuite{};
+} // namespace signals
+} // namespace test
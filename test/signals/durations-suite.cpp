@@ -13,7 +13,8 @@ struct DurationsSuite : Suite {
   DurationsSuite() : Suite{"dhe::Durations::value()"} {}
   void run(Tester &t) override {
     static auto const range_ids = std::vector<DurationRangeId>{
-        DurationRangeId::Short, DurationRangeId::Medium, DurationRangeId::Long};
+        DurationRangeId::Short, DurationRangeId::Medium, DurationRangeId::Long,
+        DurationRangeId::Micro};
     for (auto const range_id : range_ids) {
       auto const *const range_name = Duration::label(range_id);
       t.run(range_name, [range_id](Tester &t) {